@@ -1,20 +1,20 @@
 #ifndef CYCLECOUNTER
 #define CYCLECOUNTER
 
-static volatile unsigned int *DWT_CYCCNT  ;
-static volatile unsigned int *DWT_CONTROL ;
-static volatile unsigned int *SCB_DEMCR   ;
+// One measurement at a time on top of the free running cycle counter of
+// timing_scope.h, which is neither reset nor stopped here. Use TimingScope
+// for nested measurements or ones that run in interrupts.
 
-// Resets the internal cycle counter to zero
+// Starts a new measurement at zero cycles, stopped
 void ResetTimer(void);
 
-// Starts the internal cycle counter
+// Continues the measurement
 void StartTimer(void);
 
-// Stops the internal cycle counter
+// Pauses the measurement
 void StopTimer(void);
 
-// Returns the current number of cycles according to the internal cycle counter
+// Returns the cycles measured between StartTimer and StopTimer calls since ResetTimer
 unsigned int getCycles(void);
 
 #endif 
@@ -12,4 +12,10 @@
 
 void ben_dct2_f32(float32_t* pInlineBuffer, float32_t* pState, float32_t* mfcc_out, arm_rfft_fast_instance_f32* pRfft);
 
+// Computes only the first N_MFCC_COEFFS coefficients from the precomputed basis in flash
+void dct2_truncated_f32(const float32_t* log_mel_spectrogram, float32_t* mfcc_out);
+
+// As dct2_truncated_f32 with the int8 quantization of the model input folded into the basis
+void dct2_truncated_int8(const float32_t* log_mel_spectrogram, int8_t* mfccs_int8);
+
 #endif /* INC_BEN_DCT2_F32_H_ */
@@ -0,0 +1,44 @@
+/*
+ * capture.h
+ *
+ *  Low latency reader of the circular DFSDM DMA buffer. Instead of waiting for
+ *  the half and full transfer interrupts, the write position is derived from
+ *  the remaining DMA transfers and new samples are handed out in small blocks.
+ */
+
+#ifndef INC_CAPTURE_H_
+#define INC_CAPTURE_H_
+
+#include <arm_math.h>
+
+struct Capture {
+	const int32_t* buffer;
+	uint16_t length;
+	uint32_t written;  // Samples written by the DMA since the start
+	uint32_t read;     // Samples handed out
+	uint32_t overruns;
+	uint32_t dropped;  // Samples overwritten before they were read
+};
+
+void init_capture(struct Capture* capture, const int32_t* buffer, uint16_t length);
+
+// Updates the written samples from the completed buffer passes and the remaining
+// DMA transfers. The transfer complete interrupt can still be pending right after
+// the counter reloaded, so the count never goes backwards.
+uint32_t capture_update(struct Capture* capture, uint32_t passes, uint16_t remaining);
+
+// Next contiguous block of unread samples, ending at the latest at the end of the
+// buffer. Returns 0 while fewer than min_block samples are available. If the DMA
+// lapped the reader, the oldest samples are skipped and an overrun is counted.
+uint16_t capture_next_block(struct Capture* capture, uint16_t min_block, const int32_t** block);
+
+// True if the DMA overwrote the oldest unconsumed samples, i.e. the block handed
+// out last, while it was processed. Call after capture_update, counts an overrun.
+bool capture_check_late(struct Capture* capture);
+
+void capture_consume(struct Capture* capture, uint16_t n);
+
+// Current DMA write position in the buffer
+uint16_t capture_write_position(struct Capture* capture);
+
+#endif /* INC_CAPTURE_H_ */
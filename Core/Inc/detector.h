@@ -0,0 +1,43 @@
+/*
+ * detector.h
+ *
+ *  Turns the int8 model outputs of consecutive inferences into detections.
+ *  The outputs are smoothed over the last inferences, by their mean or by the
+ *  maximum per class, and a class is only reported if its smoothed score is
+ *  the unique maximum and reaches the threshold of the class. With a history
+ *  of one and thresholds of -128 this is the plain argmax.
+ */
+
+#ifndef INC_DETECTOR_H_
+#define INC_DETECTOR_H_
+
+#define DETECTOR_CLASSES 3
+#define DETECTOR_HISTORY_MAX 8
+#define DETECTOR_NONE -1
+
+#include <arm_math.h>
+
+enum DetectorSmoothing {
+	SMOOTHING_MEAN,
+	SMOOTHING_MAX
+};
+
+struct Detector {
+	int8_t history[DETECTOR_HISTORY_MAX][DETECTOR_CLASSES];
+	int8_t thresholds[DETECTOR_CLASSES];
+	int8_t scores[DETECTOR_CLASSES]; // Smoothed outputs of the last update
+	enum DetectorSmoothing smoothing;
+	uint8_t length; // Inferences smoothed over
+	uint8_t count;  // Valid entries in history
+	uint8_t next;
+};
+
+void init_detector(struct Detector* detector, enum DetectorSmoothing smoothing, uint8_t length, const int8_t* thresholds);
+
+// Forgets the history, e.g. after a trigger or a skipped inference
+void detector_reset(struct Detector* detector);
+
+// Adds the outputs of one inference, returns the detected class or DETECTOR_NONE
+int detector_update(struct Detector* detector, const int8_t* output);
+
+#endif /* INC_DETECTOR_H_ */
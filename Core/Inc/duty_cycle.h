@@ -0,0 +1,45 @@
+/*
+ * duty_cycle.h
+ *
+ *  Accounting of the time the core spends asleep in WFI against the elapsed
+ *  time, reported once per period. Sleep is measured in core cycles around
+ *  every WFI, the period in milliseconds of the HAL tick.
+ */
+
+#ifndef INC_DUTY_CYCLE_H_
+#define INC_DUTY_CYCLE_H_
+
+#include <arm_math.h>
+
+struct DutyCycle {
+	uint32_t period_ms;
+	uint32_t cycles_per_ms;
+	uint32_t period_start_ms;
+	uint64_t sleep_cycles; // In the current period
+	uint32_t wakeups;      // In the current period
+};
+
+// Summary of one finished period
+struct DutyCycleReport {
+	uint64_t total_cycles;
+	uint64_t sleep_cycles;
+	uint32_t wakeups;
+	uint32_t active_permille;
+};
+
+void init_duty_cycle(struct DutyCycle* duty_cycle, uint32_t period_ms, uint32_t cycles_per_ms, uint32_t now_ms);
+
+// Called after every wake up with the cycles spent in WFI
+void duty_cycle_add_sleep(struct DutyCycle* duty_cycle, uint32_t cycles);
+
+// True and the summary in report once period_ms passed, the next period starts at now_ms
+bool duty_cycle_period_finished(struct DutyCycle* duty_cycle, uint32_t now_ms, struct DutyCycleReport* report);
+
+// Cycles between two reads of a down counter that reloads with period cycles, at most one reload apart
+uint32_t down_counter_elapsed(uint32_t before, uint32_t after, uint32_t period);
+
+// True if the main loop may sleep until the next interrupt. A pending audio block only
+// keeps it awake if the loop runs the front-end, not from PendSV or SysTick polling.
+bool may_sleep(bool block_pending, bool inference_due, bool frontend_in_loop);
+
+#endif /* INC_DUTY_CYCLE_H_ */
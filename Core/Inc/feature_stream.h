@@ -0,0 +1,75 @@
+/*
+ * feature_stream.h
+ *
+ *  Binary stream of the front-end stages of every frame for recording
+ *  sessions, received by Tests/stream_receiver.cpp. One record per frame,
+ *  little endian:
+ *
+ *    magic (4) | sequence (4) | flags (2) | payload length (2)
+ *    sections: stage (1) | type (1) | count (2) | count values
+ *    crc32 of everything before (4)
+ *
+ *  The sequence counts front-end frames, a missing number is a record that
+ *  was dropped because the previous one was still on the wire. Records are
+ *  double buffered and sent by DMA through uart_tx_send_block.
+ */
+
+#ifndef INC_FEATURE_STREAM_H_
+#define INC_FEATURE_STREAM_H_
+
+#include <arm_math.h>
+#include "uart_tx.h"
+
+#define FEATURE_STREAM_MAGIC 0x4D525453 // "STRM"
+#define FEATURE_STREAM_RECORD_SIZE 4608
+#define FEATURE_STREAM_DISCONTINUITY 0x0001 // Audio was lost before this frame
+
+enum FeatureStreamStage {
+	STREAM_AUDIO,     // int16, the DFSDM samples >> 8
+	STREAM_SPECTRUM,  // float32, magnitude or power with FRONTEND_POWER_SPECTRUM
+	STREAM_LMS,       // float32, log mel spectrogram
+	STREAM_MFCC,      // float32
+	STREAM_INT8,      // int8, the quantized model input row
+	STREAM_STAGES
+};
+
+enum FeatureStreamType {
+	STREAM_TYPE_INT8,
+	STREAM_TYPE_INT16,
+	STREAM_TYPE_FLOAT32
+};
+
+#define STREAM_STAGE(stage) (1u << (stage))
+#define STREAM_ALL_STAGES (STREAM_STAGE(STREAM_STAGES) - 1)
+
+struct FeatureStream {
+	struct UartTx* tx;
+	uint16_t stages;     // Mask of the stages that are sent
+	uint8_t records[2][FEATURE_STREAM_RECORD_SIZE];
+	uint8_t filling;     // Record being filled, the other one may be on the wire
+	uint16_t length;     // Bytes of the record being filled
+	uint32_t sequence;
+	uint16_t flags;
+	uint32_t sent;
+	uint32_t dropped;    // Records dropped because the UART was busy
+};
+
+void init_feature_stream(struct FeatureStream* stream, struct UartTx* tx, uint16_t stages);
+
+// Starts the record of the next frame
+void feature_stream_begin(struct FeatureStream* stream);
+
+bool feature_stream_wants(const struct FeatureStream* stream, enum FeatureStreamStage stage);
+
+void feature_stream_add_audio(struct FeatureStream* stream, const int32_t* samples, uint16_t n);
+void feature_stream_add_f32(struct FeatureStream* stream, enum FeatureStreamStage stage,
+		const float32_t* values, uint16_t n);
+void feature_stream_add_int8(struct FeatureStream* stream, const int8_t* values, uint16_t n);
+
+// Flags the next record, e.g. after a gap in the audio
+void feature_stream_mark_discontinuity(struct FeatureStream* stream);
+
+// Finishes the record and sends it. Returns false if it had to be dropped.
+bool feature_stream_end(struct FeatureStream* stream);
+
+#endif /* INC_FEATURE_STREAM_H_ */
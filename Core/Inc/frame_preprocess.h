@@ -0,0 +1,18 @@
+/*
+ * frame_preprocess.h
+ *
+ *  First stage of the float32 front-end: converts the 24 bit DFSDM samples,
+ *  applies the pre-emphasis filter and the analysis window in a single pass.
+ */
+
+#ifndef INC_FRAME_PREPROCESS_H_
+#define INC_FRAME_PREPROCESS_H_
+
+#include <arm_math.h>
+
+// y[n] = x[n] - pre_emphasis * x[n-1] with x[-1] = x[0], then multiplied by
+// window[n]. Pass 0 to skip the pre-emphasis and NULL to skip the window.
+void preprocess_frame_f32(const int32_t* samples, float32_t* frame, uint32_t frame_length,
+		float32_t pre_emphasis, const float32_t* window);
+
+#endif /* INC_FRAME_PREPROCESS_H_ */
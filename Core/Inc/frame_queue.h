@@ -0,0 +1,52 @@
+/*
+ * frame_queue.h
+ *
+ *  Lock-free single producer, single consumer queue of audio block descriptors.
+ *  The DMA callbacks push one sequence numbered descriptor per filled half of
+ *  RecBuff, the main loop pops them in order. Blocks that do not fit into the
+ *  queue or that the DMA overwrote before they were processed are counted, so
+ *  every lost block shows up as a gap in the sequence numbers.
+ */
+
+#ifndef INC_FRAME_QUEUE_H_
+#define INC_FRAME_QUEUE_H_
+
+#define FRAME_QUEUE_LENGTH 4 // Power of two
+
+#include <arm_math.h>
+
+struct FrameDescriptor {
+	uint32_t sequence;
+	const int32_t* samples;
+	uint16_t length;
+};
+
+struct FrameQueue {
+	struct FrameDescriptor entries[FRAME_QUEUE_LENGTH];
+	volatile uint32_t head;          // Only written by the producer
+	volatile uint32_t tail;          // Only written by the consumer
+	volatile uint32_t next_sequence; // Producer, also counts dropped blocks
+	volatile uint32_t overruns;      // Producer, blocks dropped because the queue was full
+	uint32_t expected_sequence;      // Consumer
+	uint32_t gaps;                   // Consumer, number of discontinuities
+	uint32_t lost;                   // Consumer, blocks missing in the sequence
+	uint32_t late;                   // Consumer, blocks overwritten before processing
+};
+
+void init_frame_queue(struct FrameQueue* queue);
+
+// Producer side, called from the DMA callbacks. Returns false if the queue is full.
+bool frame_queue_push(struct FrameQueue* queue, const int32_t* samples, uint16_t length);
+
+// Consumer side. Returns false if the queue is empty, otherwise the oldest descriptor
+// and in missed the number of blocks lost since the previous one.
+bool frame_queue_pop(struct FrameQueue* queue, struct FrameDescriptor* frame, uint32_t* missed);
+
+// Consumer side, true if at least one descriptor is waiting
+bool frame_queue_pending(const struct FrameQueue* queue);
+
+// True if the DMA already started to overwrite the samples of frame, with the DMA
+// buffer split into segments blocks. Counts the frame as late.
+bool frame_queue_check_late(struct FrameQueue* queue, const struct FrameDescriptor* frame, uint32_t segments);
+
+#endif /* INC_FRAME_QUEUE_H_ */
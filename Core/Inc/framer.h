@@ -0,0 +1,34 @@
+/*
+ * framer.h
+ *
+ *  Streaming framer: collects the DFSDM samples and emits frames of
+ *  FRAME_LENGTH samples every hop samples, independent of the DMA block size.
+ */
+
+#ifndef INC_FRAMER_H_
+#define INC_FRAMER_H_
+
+#define FRAME_LENGTH 1024
+
+#include <arm_math.h>
+
+struct Framer {
+	int32_t samples[FRAME_LENGTH]; // oldest sample first
+	uint16_t count;
+	uint16_t hop;
+};
+
+void init_framer(struct Framer* framer, uint16_t hop);
+
+// Appends samples until a frame is complete, returns the number of samples consumed
+uint16_t framer_push(struct Framer* framer, const int32_t* samples, uint16_t n);
+
+bool framer_frame_ready(struct Framer* framer);
+
+// Drops the oldest hop samples of a completed frame
+void framer_advance(struct Framer* framer);
+
+// Drops all samples, used when the input is not continuous
+void framer_reset(struct Framer* framer);
+
+#endif /* INC_FRAMER_H_ */
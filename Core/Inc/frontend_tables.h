@@ -0,0 +1,47 @@
+/*
+ * frontend_tables.h
+ *
+ *  Precomputed const tables of the feature front-end. They are placed in flash
+ *  and generated by Precalculations/calc_frontend_tables.py.
+ */
+
+#ifndef INC_FRONTEND_TABLES_H_
+#define INC_FRONTEND_TABLES_H_
+
+#include <arm_math.h>
+
+#define WINDOW_LENGTH 1024
+#define N_MEL_BANDS 64
+#define N_MEL_WEIGHTS 972
+#define N_MFCC_COEFFS 13
+
+// One triangular mel filter: num_bins consecutive spectrum bins starting at
+// start_bin, weighted by the entries at weight_offset in the weight tables
+struct MelBand {
+	uint16_t start_bin;
+	uint16_t num_bins;
+	uint16_t weight_offset;
+};
+
+extern const struct MelBand mel_bands[N_MEL_BANDS];
+extern const float32_t mel_weights_f32[N_MEL_WEIGHTS];
+extern const q15_t mel_weights_q15[N_MEL_WEIGHTS];
+
+// 0.5 * ln of the weight sum of every band, see calc_log_mel_spectrogram_power
+extern const float32_t mel_power_offset_f32[N_MEL_BANDS];
+
+// Periodic Hann window as applied by tf.signal.stft in the training pipeline
+extern const float32_t hann_window_f32[WINDOW_LENGTH];
+extern const q15_t hann_window_q15[WINDOW_LENGTH];
+
+// First N_MFCC_COEFFS rows of the DCT-II scaled by sqrt(2/N), the int8 variant maps
+// the log mel spectrogram directly to the model input
+extern const float32_t dct2_basis_f32[N_MFCC_COEFFS * N_MEL_BANDS];
+extern const float32_t dct2_basis_int8_f32[N_MFCC_COEFFS * N_MEL_BANDS];
+extern const float32_t dct2_bias_int8_f32;
+
+// DCT-II basis mapping log2 mel energies (Q16) to the int8 model input (Q44)
+extern const q31_t dct2_basis_log2_int8_q28[N_MFCC_COEFFS * N_MEL_BANDS];
+extern const int64_t dct2_bias_int8_q44;
+
+#endif /* INC_FRONTEND_TABLES_H_ */
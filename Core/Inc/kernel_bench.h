@@ -0,0 +1,50 @@
+/*
+ * kernel_bench.h
+ *
+ *  Microbenchmark of single kernels with the shapes of a real model. Every
+ *  operator of the model's subgraph is set up on its own with KernelRunner
+ *  (micro/kernels/kernel_runner.h): tensors with the shapes, types and
+ *  quantization of the flatbuffer, the constant tensors on the model's data,
+ *  the builtin options parsed like the interpreter does. Invoke() is timed
+ *  with cycle_count() of timing_scope.h, so the results are cycles on the
+ *  target and nanoseconds on the host (Tests/kernel_bench_host.cpp).
+ *
+ *  KernelRunner keeps the kernel's persistent and scratch buffers in a
+ *  static buffer of 10000 bytes, the tensors of one operator at a time are
+ *  placed in the memory passed in.
+ */
+
+#ifndef INC_KERNEL_BENCH_H_
+#define INC_KERNEL_BENCH_H_
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+#define KERNEL_BENCH_MAX_TENSORS 8 // Inputs and outputs of one operator
+#define KERNEL_BENCH_REPEATS 16    // Invoke()s per KernelRunner, it never frees its temporary eval tensors
+
+struct KernelBenchResult {
+	int node;
+	const char* op;
+	TfLiteStatus status;         // kTfLiteError if the operator could not be set up or failed
+	const TfLiteIntArray* input; // Shape of the first input and the first output, only valid in the callback
+	const TfLiteIntArray* output;
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+typedef void (*KernelBenchReport)(const struct KernelBenchResult* result);
+
+// Runs every operator of the model rounds times KERNEL_BENCH_REPEATS and
+// passes the result per operator to report. Returns the number of operators
+// that could not be benchmarked, e.g. because op_resolver lacks their kernel
+// or memory is too small.
+int kernel_bench_model(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+		uint8_t* memory, size_t memory_size, int rounds, tflite::ErrorReporter* error_reporter,
+		KernelBenchReport report);
+
+#endif /* INC_KERNEL_BENCH_H_ */
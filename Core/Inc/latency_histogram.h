@@ -0,0 +1,34 @@
+/*
+ * latency_histogram.h
+ *
+ *  Histogram of latencies in milliseconds with log-spaced bins, every
+ *  octave is split into 2^LATENCY_SUB_BITS bins so the resolution stays
+ *  within 12.5% from a few ms to tens of seconds. Below 16 ms every bin is
+ *  1 ms wide. The last bin collects everything above the range.
+ */
+
+#ifndef INC_LATENCY_HISTOGRAM_H_
+#define INC_LATENCY_HISTOGRAM_H_
+
+#define LATENCY_SUB_BITS 3
+#define LATENCY_BINS 104        // Up to LATENCY_RANGE_MS
+#define LATENCY_RANGE_MS 32768  // Latencies from here on share the last bin
+
+#include <arm_math.h>
+
+struct LatencyHistogram {
+	uint32_t bins[LATENCY_BINS];
+	uint32_t count;
+	uint32_t sum_ms;
+	uint32_t max_ms;
+};
+
+void init_latency_histogram(struct LatencyHistogram* histogram);
+
+void latency_record(struct LatencyHistogram* histogram, uint32_t ms);
+
+// Smallest latency that at least percent of the samples do not exceed, in bin
+// resolution but at most the largest latency recorded
+uint32_t latency_percentile(struct LatencyHistogram* histogram, uint32_t percent);
+
+#endif /* INC_LATENCY_HISTOGRAM_H_ */
@@ -5,4 +5,12 @@
 
 void calc_log_mel_spectrogram(float32_t* magnitude, float32_t* mel_spectrogram);
 
+// Same from the squared magnitude, without square roots and with fast_log2_f32
+// instead of logf. Exact if the magnitude is flat within every mel band.
+void calc_log_mel_spectrogram_power(float32_t* power, float32_t* mel_spectrogram);
+
+// log2 of block_size positive, normal floats from exponent and mantissa bits,
+// the absolute error is below 1e-3
+void fast_log2_f32(const float32_t* src, float32_t* dst, uint32_t block_size);
+
 #endif //LINEAR_TO_MEL_WEIGHT_LIST_H
@@ -0,0 +1,36 @@
+/*
+ * log_tokens.h
+ *
+ *  Format strings of the runtime log. With TOKENIZED_LOG only the index of
+ *  the entry and the raw arguments are sent, Tests/token_decoder.py parses
+ *  this file to print the text again. Append new entries at the end so that
+ *  older captures keep decoding, arguments are 32 bit integers only.
+ */
+
+#ifndef INC_LOG_TOKENS_H_
+#define INC_LOG_TOKENS_H_
+
+#define LOG_TOKENS(X) \
+	X(LOG_START, "START TEST\r\n") \
+	X(LOG_FAILED_TENSORS, "Failed tensors\r\n") \
+	X(LOG_INPUT_SIZE, "Model input size: %d\r\n") \
+	X(LOG_INPUT_ELEMENTS, "Number of input elements: %lu\r\n") \
+	X(LOG_NOT_STREAMABLE, "Model not streamable\r\n") \
+	X(LOG_GAP, "Gap: %lu lost, %lu late, %lu overruns\r\n") \
+	X(LOG_GAP_CAPTURE, "Gap: %lu overruns, %lu samples dropped\r\n") \
+	X(LOG_DUTY, "Duty: active %lu.%lu%%, sleep %lu/%lu kcycles, %lu wakeups\r\n") \
+	X(LOG_SILENCE, "[%d] Silence, skipped %lu/%lu\r\n") \
+	X(LOG_CYCLES, "##### [%d]s\r\n") \
+	X(LOG_OUTPUT, "Output %d: [%d, %d, %d]\r\n") \
+	X(LOG_OUTPUT_GAP, "Output %d: [%d, %d, %d] gap\r\n") \
+	X(LOG_KEYWORD, "[%d] I am bit deaf, but did you say <<Hey Snips>>?!\r\n") \
+	X(LOG_NOISE, "[%d] Hearing noise I don't understand.\r\n") \
+	X(LOG_NOTHING, "[%d] Hearing nothing.\r\n") \
+	X(LOG_STATUS, "Status: %lu lost, %lu late, %lu overruns, %lu messages dropped\r\n") \
+	X(LOG_STATUS_CAPTURE, "Status: %lu overruns, %lu samples dropped, %lu messages dropped\r\n") \
+	X(LOG_STREAM, "Stream: %lu records sent, %lu dropped\r\n") \
+	X(LOG_ARENA, "Tensor arena: %lu of %lu bytes used\r\n") \
+	X(LOG_MEMORY, "Stack: fe %lu staging %lu invoke %lu report %lu peak %lu, heap %lu, free %lu, %lu sbrk failures\r\n") \
+	X(LOG_RING_BUFFER_FILLED, "Ring Buffer initialized!\r\n")
+
+#endif /* INC_LOG_TOKENS_H_ */
@@ -54,6 +54,7 @@ extern "C" {
 void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
+void PendSV_Callback(void);
 
 /* USER CODE END EFP */
 
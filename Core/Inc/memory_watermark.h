@@ -0,0 +1,47 @@
+/*
+ * memory_watermark.h
+ *
+ *  Stack and heap high-water marks per stage of the main loop. The free RAM
+ *  between the heap and the stack pointer is painted with a pattern once,
+ *  at the end of a stage the lowest overwritten word is its deepest stack
+ *  use, below _estack. That part is painted again, so every stage is
+ *  measured on its own. The heap is the highest end _sbrk (sysmem.c) has
+ *  handed out, free is the smallest gap seen between it and the stack.
+ *
+ *  Interrupts use the same stack and count towards the stage they preempt.
+ *  A checkpoint compares every painted word below the stack, about a cycle
+ *  per byte of free RAM.
+ */
+
+#ifndef INC_MEMORY_WATERMARK_H_
+#define INC_MEMORY_WATERMARK_H_
+
+#include <stdint.h>
+
+#define MEMORY_PAINT 0xC5C5C5C5
+#define MEMORY_PAINT_GUARD 64 // Bytes below the stack pointer that are not painted
+
+enum MemoryStage {
+	MEMORY_FRONTEND,  // process_audio(), unless the front-end runs in PendSV
+	MEMORY_STAGING,   // Model input copied from the ring buffer
+	MEMORY_INVOKE,
+	MEMORY_REPORTING, // Output, detector and status reports
+	MEMORY_STAGES
+};
+
+struct MemoryWatermark {
+	uint32_t stage_peak[MEMORY_STAGES]; // Deepest stack of the stage in bytes
+	uint32_t stack_peak;                // Over all stages
+	uint32_t heap_peak;                 // Bytes _sbrk has handed out
+	uint32_t free_min;                  // Smallest gap between heap and stack in bytes
+	uint32_t heap_failures;             // Requests _sbrk refused
+	uint32_t* painted;                  // Lowest painted word
+};
+
+// Paints the free RAM below the caller's stack, call early in main()
+void init_memory_watermark(struct MemoryWatermark* watermark);
+
+// Updates the marks with the stack used since the previous checkpoint
+void memory_watermark_stage(struct MemoryWatermark* watermark, enum MemoryStage stage);
+
+#endif /* INC_MEMORY_WATERMARK_H_ */
@@ -0,0 +1,268 @@
+/*
+ * mfcc_frontend.h
+ *
+ *  Header-only float32 MFCC front-end configured by template parameters. The
+ *  Hann window, the sparse mel filterbank and the truncated DCT basis are
+ *  computed by the compiler the same way as tf.signal does in the training
+ *  pipeline, so a different frame length, number of mel bands or MFCCs needs
+ *  neither the Python generators nor edits to frontend_tables.cpp.
+ */
+
+#ifndef INC_MFCC_FRONTEND_H_
+#define INC_MFCC_FRONTEND_H_
+
+#include <arm_math.h>
+#include <math.h>
+#include "frontend_tables.h"
+#include "frame_preprocess.h"
+
+// Math for the table generation, constexpr and in double precision
+
+constexpr double constexpr_log(double x){
+	int32_t exponent = 0;
+	while(x >= 2.0){
+		x /= 2.0;
+		exponent++;
+	}
+	while(x < 1.0){
+		x *= 2.0;
+		exponent--;
+	}
+
+	// ln(x) = 2 * atanh((x - 1) / (x + 1)) with the argument below 1/3
+	double y = (x - 1.0) / (x + 1.0);
+	double term = y;
+	double sum = 0.0;
+	for(int k = 1; k < 60; k += 2){
+		sum += term / k;
+		term *= y * y;
+	}
+	return 2.0 * sum + exponent * 0.69314718055994530942;
+}
+
+constexpr double constexpr_cos(double x){
+	const double pi = 3.14159265358979323846;
+	x -= 2.0 * pi * (int64_t)(x / (2.0 * pi));
+	if(x > pi){
+		x -= 2.0 * pi;
+	} else if(x < -pi){
+		x += 2.0 * pi;
+	}
+
+	double term = 1.0;
+	double sum = 0.0;
+	for(int k = 0; k < 30; k++){
+		sum += term;
+		term *= -x * x / ((2 * k + 1) * (2 * k + 2));
+	}
+	return sum;
+}
+
+constexpr double constexpr_sqrt(double x){
+	double y = (x > 1.0) ? x : 1.0;
+	for(int i = 0; i < 100; i++){
+		y = 0.5 * (y + x / y);
+	}
+	return y;
+}
+
+constexpr double hertz_to_mel(double hertz){
+	return 1127.0 * constexpr_log(1.0 + hertz / 700.0);
+}
+
+// Mel positions of the spectrum bins and band edges as in tf.signal.linear_to_mel_weight_matrix.
+// The training pipeline drops the Nyquist bin before building the matrix, so the
+// FrameLen / 2 bins are spaced by nyquist / (FrameLen / 2 - 1) like there.
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t SampleRate, uint32_t LowerEdgeHz, uint32_t UpperEdgeHz>
+struct MelScale {
+	static constexpr uint32_t num_bins = FrameLen / 2;
+	static constexpr uint32_t num_mel = NumMel;
+	double bin_mel[num_bins];
+	double edge_mel[NumMel + 2];
+
+	constexpr MelScale() : bin_mel(), edge_mel() {
+		for(uint32_t bin = 0; bin < num_bins; bin++){
+			bin_mel[bin] = hertz_to_mel(bin * (SampleRate / 2.0) / (num_bins - 1));
+		}
+
+		double lower = hertz_to_mel(LowerEdgeHz);
+		double upper = hertz_to_mel(UpperEdgeHz);
+		for(uint32_t i = 0; i < NumMel + 2; i++){
+			edge_mel[i] = lower + i * (upper - lower) / (NumMel + 1);
+		}
+	}
+
+	// Triangular filter, the DC bin is always zero
+	constexpr double weight(uint32_t band, uint32_t bin) const {
+		if(bin == 0){
+			return 0.0;
+		}
+		double lower_slope = (bin_mel[bin] - edge_mel[band]) / (edge_mel[band + 1] - edge_mel[band]);
+		double upper_slope = (edge_mel[band + 2] - bin_mel[bin]) / (edge_mel[band + 2] - edge_mel[band + 1]);
+		double w = (lower_slope < upper_slope) ? lower_slope : upper_slope;
+		return (w > 0.0) ? w : 0.0;
+	}
+
+	constexpr uint32_t num_weights() const {
+		uint32_t count = 0;
+		for(uint32_t band = 0; band < NumMel; band++){
+			for(uint32_t bin = 0; bin < num_bins; bin++){
+				if(weight(band, bin) > 0.0){
+					count++;
+				}
+			}
+		}
+		return count;
+	}
+};
+
+// Sparse filterbank in the layout of frontend_tables.h
+template<class Scale, uint32_t NumWeights>
+struct MelFilterbank {
+	struct MelBand bands[Scale::num_mel];
+	float32_t weights[NumWeights];
+
+	constexpr MelFilterbank(const Scale& scale) : bands(), weights() {
+		uint16_t offset = 0;
+		for(uint32_t band = 0; band < Scale::num_mel; band++){
+			bands[band].start_bin = 0;
+			bands[band].num_bins = 0;
+			bands[band].weight_offset = offset;
+			for(uint32_t bin = 0; bin < Scale::num_bins; bin++){
+				double w = scale.weight(band, bin);
+				if(w > 0.0){
+					if(bands[band].num_bins == 0){
+						bands[band].start_bin = bin;
+					}
+					bands[band].num_bins++;
+					weights[offset++] = (float32_t)w;
+				}
+			}
+		}
+	}
+};
+
+// Periodic Hann window, the default of tf.signal.stft
+template<uint32_t FrameLen>
+struct HannWindow {
+	float32_t samples[FrameLen];
+
+	constexpr HannWindow() : samples() {
+		for(uint32_t n = 0; n < FrameLen; n++){
+			samples[n] = (float32_t)(0.5 - 0.5 * constexpr_cos(2.0 * 3.14159265358979323846 * n / FrameLen));
+		}
+	}
+};
+
+// First NumMfcc rows of the DCT-II scaled by sqrt(2/N)
+template<uint32_t NumMel, uint32_t NumMfcc>
+struct DctBasis {
+	float32_t coefficients[NumMfcc * NumMel];
+
+	constexpr DctBasis() : coefficients() {
+		for(uint32_t k = 0; k < NumMfcc; k++){
+			for(uint32_t n = 0; n < NumMel; n++){
+				coefficients[k * NumMel + n] = (float32_t)(constexpr_sqrt(2.0 / NumMel)
+						* constexpr_cos(3.14159265358979323846 * k * (2 * n + 1) / (2 * NumMel)));
+			}
+		}
+	}
+};
+
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t NumMfcc,
+		uint32_t SampleRate = 9524, uint32_t LowerEdgeHz = 80, uint32_t UpperEdgeHz = 4700>
+class MfccFrontend {
+	static_assert(FrameLen >= 32 && FrameLen <= 4096 && (FrameLen & (FrameLen - 1)) == 0,
+			"arm_rfft_fast_f32 needs a power of two between 32 and 4096");
+	static_assert(NumMfcc <= NumMel, "more MFCCs than mel bands");
+	static_assert(LowerEdgeHz < UpperEdgeHz && 2 * UpperEdgeHz <= SampleRate, "invalid band edges");
+
+public:
+	typedef MelScale<FrameLen, NumMel, SampleRate, LowerEdgeHz, UpperEdgeHz> Scale;
+
+	static constexpr uint32_t frame_length = FrameLen;
+	static constexpr uint32_t num_mel = NumMel;
+	static constexpr uint32_t num_mfcc = NumMfcc;
+
+	static constexpr Scale scale = Scale();
+	static constexpr uint32_t num_mel_weights = scale.num_weights();
+	static constexpr MelFilterbank<Scale, num_mel_weights> filterbank = MelFilterbank<Scale, num_mel_weights>(scale);
+	static constexpr HannWindow<FrameLen> window = HannWindow<FrameLen>();
+	static constexpr DctBasis<NumMel, NumMfcc> dct_basis = DctBasis<NumMel, NumMfcc>();
+
+	// normalize_mfccs divides the MFCCs by 512 before quantizing them to the model input
+	arm_status init(float32_t input_scale, int32_t input_zero_point, float32_t pre_emphasis, bool use_window){
+		int8_scale = 1.0f / (512.0f * input_scale);
+		int8_bias = 0.5f / input_scale + input_zero_point;
+		this->pre_emphasis = pre_emphasis;
+		this->use_window = use_window;
+		return arm_rfft_fast_init_f32(&rfft, FrameLen);
+	}
+
+	// log_mel_spectrogram has NumMel entries and may point into the scratch buffers
+	void calc_log_mel_spectrogram(const int32_t* samples, float32_t* log_mel_spectrogram){
+		preprocess_frame_f32(samples, buffer1, FrameLen, pre_emphasis, use_window ? window.samples : NULL);
+		arm_rfft_fast_f32(&rfft, buffer1, buffer2, 0);
+		arm_cmplx_mag_f32(buffer2, buffer1, FrameLen / 2);
+
+		float32_t sum = 0;
+		for(uint32_t band = 0; band < NumMel; band++){
+			arm_dot_prod_f32(&buffer1[filterbank.bands[band].start_bin],
+					&filterbank.weights[filterbank.bands[band].weight_offset],
+					filterbank.bands[band].num_bins, &sum);
+			log_mel_spectrogram[band] = logf(sum + 1e-6f);
+		}
+	}
+
+	void calc_mfccs(const int32_t* samples, float32_t* mfccs){
+		calc_log_mel_spectrogram(samples, buffer2);
+		for(uint32_t k = 0; k < NumMfcc; k++){
+			arm_dot_prod_f32(buffer2, &dct_basis.coefficients[k * NumMel], NumMel, &mfccs[k]);
+		}
+	}
+
+	void calc_mfccs_int8(const int32_t* samples, int8_t* mfccs_int8){
+		float32_t mfcc;
+		calc_log_mel_spectrogram(samples, buffer2);
+		for(uint32_t k = 0; k < NumMfcc; k++){
+			arm_dot_prod_f32(buffer2, &dct_basis.coefficients[k * NumMel], NumMel, &mfcc);
+			mfcc = mfcc * int8_scale + int8_bias;
+
+			// Truncate towards zero like the cast in normalize_mfccs, but saturate
+			if(mfcc >= 127.0f){
+				mfccs_int8[k] = 127;
+			} else if(mfcc <= -128.0f){
+				mfccs_int8[k] = -128;
+			} else {
+				mfccs_int8[k] = (int8_t)mfcc;
+			}
+		}
+	}
+
+private:
+	arm_rfft_fast_instance_f32 rfft;
+	float32_t buffer1[FrameLen];
+	float32_t buffer2[FrameLen];
+	float32_t int8_scale;
+	float32_t int8_bias;
+	float32_t pre_emphasis;
+	bool use_window;
+};
+
+// Definitions of the tables, only the ones used at run time end up in flash
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t NumMfcc, uint32_t SampleRate, uint32_t LowerEdgeHz, uint32_t UpperEdgeHz>
+constexpr typename MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::Scale
+MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::scale;
+
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t NumMfcc, uint32_t SampleRate, uint32_t LowerEdgeHz, uint32_t UpperEdgeHz>
+constexpr MelFilterbank<typename MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::Scale,
+		MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::num_mel_weights>
+MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::filterbank;
+
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t NumMfcc, uint32_t SampleRate, uint32_t LowerEdgeHz, uint32_t UpperEdgeHz>
+constexpr HannWindow<FrameLen> MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::window;
+
+template<uint32_t FrameLen, uint32_t NumMel, uint32_t NumMfcc, uint32_t SampleRate, uint32_t LowerEdgeHz, uint32_t UpperEdgeHz>
+constexpr DctBasis<NumMel, NumMfcc> MfccFrontend<FrameLen, NumMel, NumMfcc, SampleRate, LowerEdgeHz, UpperEdgeHz>::dct_basis;
+
+#endif /* INC_MFCC_FRONTEND_H_ */
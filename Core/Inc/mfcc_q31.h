@@ -0,0 +1,45 @@
+/*
+ * mfcc_q31.h
+ *
+ *  Integer-only alternative to the float32 MFCC front-end. The samples are
+ *  block normalized to q31, transformed with the q31 real FFT and run through
+ *  the mel filterbank, an integer log2 and a DCT whose coefficients already
+ *  contain the int8 quantization of the model input.
+ */
+
+#ifndef INC_MFCC_Q31_H_
+#define INC_MFCC_Q31_H_
+
+#include <arm_math.h>
+
+// log2(1e-6) in Q16, used for empty mel bands like the 1e-6 offset of the float path
+#define LOG2_MEL_FLOOR_Q16 -1306235
+
+struct MfccQ31 {
+	arm_rfft_instance_q31 rfft;
+	uint32_t frame_length;
+	uint8_t log2_frame_length;
+	q15_t pre_emphasis;
+	const q15_t* window;
+};
+
+// pre_emphasis and window as for preprocess_frame_f32 (0 and NULL disable them)
+arm_status init_mfcc_q31(struct MfccQ31* mfcc, uint32_t frame_length, q15_t pre_emphasis, const q15_t* window);
+
+// Converts the 24 bit DFSDM samples to q31 with the largest shift that does not
+// overflow, applying pre-emphasis and window on the way, returns the shift
+int16_t convert_samples_q31(const int32_t* samples, q31_t* frame, uint32_t frame_length,
+		q15_t pre_emphasis, const q15_t* window);
+
+// log2 in Q16 of a non zero unsigned integer
+int32_t log2_q16(uint64_t x);
+
+// magnitude is the linear spectrum scaled by 2^(exponent - 15)
+void calc_log2_mel_spectrogram_q31(const q31_t* magnitude, int16_t exponent, int32_t* log2_mel_q16);
+
+void dct2_int8(const int32_t* log2_mel_q16, int8_t* mfccs_int8);
+
+// pFrame (frame_length) and pState (2 * frame_length) are scratch buffers
+void calc_mfccs_q31(struct MfccQ31* mfcc, const int32_t* samples, q31_t* pFrame, q31_t* pState, int8_t* mfccs_int8);
+
+#endif /* INC_MFCC_Q31_H_ */
@@ -0,0 +1,89 @@
+/*
+ * op_profiler.h
+ *
+ *  Cycles per operator of the interpreter, for every node of the model and
+ *  across all Invokes. OpProfiler is a tflite::Profiler that allows several
+ *  open events at a time, keeps the last events in a ring and min, mean and
+ *  max per node. MicroInterpreter only reports operator events in builds
+ *  without NDEBUG, so ProfilingOpResolver wraps the kernels of an inner
+ *  resolver and brackets every invoke itself, which works in release builds
+ *  as well. The cycles are read from the free running counter of
+ *  timing_scope.h, interrupts that preempt a kernel count towards it.
+ */
+
+#ifndef INC_OP_PROFILER_H_
+#define INC_OP_PROFILER_H_
+
+#include "tensorflow/lite/core/api/profiler.h"
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+
+#define OP_PROFILER_NODES 16  // Nodes of the model with statistics
+#define OP_PROFILER_OPS 8     // Distinct kernels ProfilingOpResolver can wrap, one profiled_invoke_op each
+#define OP_PROFILER_EVENTS 64 // Ring of the last events, also the limit of open events
+
+struct OpProfileEvent {
+	uint32_t start;
+	uint32_t end;
+	int16_t node; // -1 for events that are no operator
+	bool open;
+};
+
+struct OpProfileStats {
+	const char* name;
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+};
+
+class OpProfiler : public tflite::Profiler {
+public:
+	OpProfiler();
+
+	// event_metadata1 is the node index of OPERATOR_INVOKE_EVENT
+	uint32_t BeginEvent(const char* tag, EventType event_type,
+			int64_t event_metadata1, int64_t event_metadata2) override;
+	void EndEvent(uint32_t event_handle) override;
+	void AddEvent(const char* tag, EventType event_type, uint64_t start,
+			uint64_t end, int64_t event_metadata1, int64_t event_metadata2) override;
+
+	void Reset();
+
+	int nodes; // Highest node index seen + 1
+	struct OpProfileStats stats[OP_PROFILER_NODES];
+	struct OpProfileEvent events[OP_PROFILER_EVENTS];
+	uint32_t written;
+	uint32_t dropped; // Events of nodes beyond OP_PROFILER_NODES or ended after their slot was reused
+
+private:
+	void record(int node, const char* tag, uint32_t cycles);
+	TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+// Resolver that hands out the kernels of inner with their invoke bracketed by
+// events of profiler
+class ProfilingOpResolver : public tflite::MicroOpResolver {
+public:
+	ProfilingOpResolver(const tflite::MicroOpResolver& inner, OpProfiler* profiler);
+
+	const TfLiteRegistration* FindOp(tflite::BuiltinOperator op) const override;
+	const TfLiteRegistration* FindOp(const char* op) const override;
+	BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override;
+
+	// Maps the nodes of the interpreter to their kernels, after AllocateTensors()
+	// and before the first Invoke(). Nodes beyond OP_PROFILER_NODES run without
+	// profile, false if there are any.
+	bool attach(const tflite::MicroInterpreter* interpreter);
+
+private:
+	const TfLiteRegistration* wrap(const TfLiteRegistration* registration) const;
+
+	const tflite::MicroOpResolver& inner;
+	mutable TfLiteRegistration registrations[OP_PROFILER_OPS];
+	mutable const TfLiteRegistration* originals[OP_PROFILER_OPS];
+	mutable int ops;
+};
+
+#endif /* INC_OP_PROFILER_H_ */
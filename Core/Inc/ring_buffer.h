@@ -10,14 +10,21 @@
 
 #define BUFFERSIZE 93
 #define N_MFCC 13
-#define MIN_DIST 20 // Minimal distance between buffer_ptr and last_inference_head before doing inference again
+#define MIN_DIST 20 // Default number of new rows after a trigger before the next inference
+#define INFERENCE_STRIDE_DEFAULT 1 // Default number of new rows between two inferences, 1 runs one per row
 
 #include <arm_math.h>
 
 struct RingBuffer {
-	int8_t data[BUFFERSIZE][N_MFCC];
+	// Every row is stored twice, at buffer_ptr and buffer_ptr + BUFFERSIZE, so the
+	// latest BUFFERSIZE rows always start contiguously at buffer_ptr
+	int8_t data[2 * BUFFERSIZE][N_MFCC];
 	uint16_t last_inference_head;
-	uint16_t buffer_ptr;
+	volatile uint16_t buffer_ptr;
+	volatile uint32_t version; // Incremented by every insert_data, only init_ring_buffer resets it
+	uint16_t rows_since_gap; // Rows inserted since the last discontinuity, at most BUFFERSIZE
+	uint16_t inference_stride; // New rows needed for the next inference
+	uint16_t refractory_rows;  // New rows needed after a trigger
 	bool filled;
 	bool triggered;
 };
@@ -26,14 +33,27 @@ void set_triggered(struct RingBuffer* rb);
 
 void init_ring_buffer(struct RingBuffer* rb);
 
+// Runs an inference every stride new rows and refractory_rows after a trigger at the earliest
+void set_inference_cadence(struct RingBuffer* rb, uint16_t stride, uint16_t refractory_rows);
+
 void insert_data(struct RingBuffer* rb, int8_t* data);
 
 void increment_buffer_ptr(struct RingBuffer* rb);
 
-void copy_inference_batch(struct RingBuffer* rb, int8_t* batch);
+// Copies the latest BUFFERSIZE rows, returns the number of rows inserted up to the newest one
+uint32_t copy_inference_batch(struct RingBuffer* rb, int8_t* batch);
+
+// Latest BUFFERSIZE rows, oldest first, valid until the next insert_data
+const int8_t* get_inference_window(struct RingBuffer* rb);
 
 void update_last_inference_head(struct RingBuffer* rb);
 
+// Marks that the audio between the last and the next row is not continuous
+void mark_discontinuity(struct RingBuffer* rb);
+
+// True if the inference window contains no discontinuity
+bool window_continuous(struct RingBuffer* rb);
+
 int distance_buffer_ptr_last_inference_head(struct RingBuffer* rb);
 
 bool do_inference(struct RingBuffer* rb);
@@ -0,0 +1,70 @@
+/*
+ * stage_trace.h
+ *
+ *  Ring of timestamped events along the path from the DMA callback to the
+ *  detection decision. The timestamps are core cycles of TIM2, which unlike
+ *  the DWT counter of timing_scope.h keeps counting while the core sleeps.
+ *  The ring is dumped on request in one piece, header first, and
+ *  evaluated by Tests/stage_trace.py.
+ */
+
+#ifndef INC_STAGE_TRACE_H_
+#define INC_STAGE_TRACE_H_
+
+#include <arm_math.h>
+
+#define STAGE_TRACE_EVENTS 512
+#define STAGE_TRACE_MAGIC 0x45435254 // "TRCE"
+
+enum TraceStage {
+	TRACE_DMA,          // Half of RecBuff ready, id is the half since start
+	TRACE_FRAME,        // Front-end starts a frame, id is the half of its newest sample
+	TRACE_PREPROCESS,   // Ends of the float32 front-end stages
+	TRACE_FFT,
+	TRACE_MAGNITUDE,
+	TRACE_MEL,
+	TRACE_DCT,
+	TRACE_ROW,          // Row inserted into the ring buffer
+	TRACE_INFERENCE,    // Inference starts, id is the inference counter
+	TRACE_STAGING,      // Model input copied
+	TRACE_INVOKE,       // Invoke() returned
+	TRACE_DECISION,     // Detector updated and reported
+	TRACE_STAGES
+};
+
+struct TraceEvent {
+	uint32_t timestamp;
+	uint16_t id;
+	uint8_t stage;
+	uint8_t reserved;
+};
+
+struct StageTrace {
+	// Sent as the header of a dump
+	uint32_t magic;
+	uint32_t written;    // Events recorded since start, the ring holds the last ones
+	uint32_t capacity;
+	uint32_t timer_hz;
+	struct TraceEvent events[STAGE_TRACE_EVENTS];
+
+	volatile bool frozen; // A dump is on the wire, new events are dropped
+	uint32_t dropped;
+	uint16_t frame;       // Half of the newest sample of the frame in the front-end
+};
+
+// Starts TIM2 as a free running 32 bit counter at timer_hz, the APB1 timer clock
+void init_stage_trace(struct StageTrace* trace, uint32_t timer_hz);
+
+// Safe from interrupts and the main loop
+void stage_trace_record(struct StageTrace* trace, enum TraceStage stage, uint16_t id);
+
+// Records TRACE_FRAME, the following stage events of the front-end get the same id
+void stage_trace_begin_frame(struct StageTrace* trace, uint16_t half);
+void stage_trace_frame_stage(struct StageTrace* trace, enum TraceStage stage);
+
+// Stops recording and returns the header and events to send
+const uint8_t* stage_trace_freeze(struct StageTrace* trace, uint16_t* length);
+
+void stage_trace_resume(struct StageTrace* trace);
+
+#endif /* INC_STAGE_TRACE_H_ */
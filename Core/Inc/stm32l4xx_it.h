@@ -59,7 +59,8 @@ void SysTick_Handler(void);
 void DMA1_Channel4_IRQHandler(void);
 void DFSDM1_FLT0_IRQHandler(void);
 /* USER CODE BEGIN EFP */
-
+void DMA2_Channel6_IRQHandler(void);
+void USART1_IRQHandler(void);
 /* USER CODE END EFP */
 
 #ifdef __cplusplus
@@ -0,0 +1,91 @@
+/*
+ * streaming_head.h
+ *
+ *  Streaming evaluation of the first two CONV_2D layers of the model. Both
+ *  layers see the whole window through a stride of at most 2 in time, so every
+ *  output row away from the window edges depends on five input rows only and
+ *  stays valid while the window slides. Those rows are cached by the absolute
+ *  index of their centre row and only the rows of new MFCCs and the two padded
+ *  edge rows are computed per inference. The layers after the first MAX_POOL_2D
+ *  run unchanged in the interpreter.
+ *
+ *  The layers are read from the unmodified model, StreamingOpResolver wraps the
+ *  CONV_2D kernel so the interpreter takes the output of the second layer from
+ *  the cache instead. The results are bit exact to a full Invoke().
+ */
+
+#ifndef INC_STREAMING_HEAD_H_
+#define INC_STREAMING_HEAD_H_
+
+#define STREAM_HISTORY 96 // Cached rows per layer, at least BUFFERSIZE
+#define STREAM_ROW1_MAX 48 // Width * channels of a row of the first layer
+#define STREAM_ROW2_MAX 112 // Width * channels of a row of the second layer
+#define STREAM_CHANNELS_MAX 16
+
+#include <arm_math.h>
+#include "tensorflow/lite/micro/micro_interpreter.h"
+#include "tensorflow/lite/micro/micro_op_resolver.h"
+
+// Quantized 3 x KW convolution with SAME padding, evaluated one output row at a time
+struct StreamConv {
+	const int8_t* filter; // OHWI
+	const int32_t* bias;
+	int32_t multiplier[STREAM_CHANNELS_MAX];
+	int32_t shift[STREAM_CHANNELS_MAX];
+	int32_t input_offset;
+	int32_t output_offset;
+	int32_t activation_min;
+	int32_t activation_max;
+	uint16_t in_width;
+	uint16_t in_channels;
+	uint16_t out_width;
+	uint16_t out_channels;
+	uint16_t kernel_width;
+	uint16_t stride_width;
+	uint16_t pad_left;
+	int32_t output_tensor;
+};
+
+struct StreamingHead {
+	struct StreamConv conv[2];
+	uint16_t window_rows;   // Input rows of the model
+	uint16_t out_rows;      // Output rows of the second layer
+	// Rows of the first layer by the absolute index of their centre input row,
+	// rows of the second layer by the absolute index of their centre row of the first
+	int8_t rows1[STREAM_HISTORY][STREAM_ROW1_MAX];
+	int8_t rows2[STREAM_HISTORY][STREAM_ROW2_MAX];
+	int8_t edge1[2][STREAM_ROW1_MAX]; // Padded first and last row of the first layer
+	int8_t edge2[2][STREAM_ROW2_MAX]; // Padded first and last row of the second layer
+	uint32_t rows1_end;     // Cached centres end here, exclusive
+	uint32_t rows2_end;
+	uint32_t window_start;  // Absolute index of the oldest row of the prepared window
+	uint32_t rows_computed; // Rows of both layers computed for the last window
+	bool initialized;
+	bool enabled;           // Clear to run the model unchanged, e.g. for comparisons
+	bool prepared;          // The cache matches the model input of the next Invoke()
+};
+
+// Checks that the model starts with two suitable CONV_2D layers and reads their
+// parameters, call after AllocateTensors(). Returns false if the model cannot be streamed.
+bool init_streaming_head(struct StreamingHead* head, const tflite::Model* model, const tflite::MicroInterpreter* interpreter);
+
+// Brings the cache up to date with the model input window, whose newest row has the
+// absolute index rows_inserted - 1 as returned by copy_inference_batch
+void streaming_head_update(struct StreamingHead* head, const int8_t* window, uint32_t rows_inserted);
+
+// Resolver that hands out the CONV_2D kernel of inner with the streaming shortcut,
+// every other op unchanged
+class StreamingOpResolver : public tflite::MicroOpResolver {
+public:
+	StreamingOpResolver(const tflite::MicroOpResolver& inner, struct StreamingHead* head);
+
+	const TfLiteRegistration* FindOp(tflite::BuiltinOperator op) const override;
+	const TfLiteRegistration* FindOp(const char* op) const override;
+	BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override;
+
+private:
+	const tflite::MicroOpResolver& inner;
+	TfLiteRegistration conv_registration;
+};
+
+#endif /* INC_STREAMING_HEAD_H_ */
@@ -0,0 +1,17 @@
+/*
+ * tensor_arena_size.h
+ *
+ *  Generated by Tests/arena_sizer.cpp from MFCC21.h, do not edit. Rerun
+ *  it when the model or the kernels change.
+ *
+ *  Measured with 64 bit pointers: 9008 bytes head (2064 scratch), 3512 bytes
+ *  tail, 10% margin.
+ */
+
+#ifndef INC_TENSOR_ARENA_SIZE_H_
+#define INC_TENSOR_ARENA_SIZE_H_
+
+#define TENSOR_ARENA_USED 12520 // Bytes AllocateTensors() needs
+#define TENSOR_ARENA_SIZE 13824
+
+#endif /* INC_TENSOR_ARENA_SIZE_H_ */
@@ -0,0 +1,65 @@
+/*
+ * timing_scope.h
+ *
+ *  Named timing slots on a free running cycle counter. A TimingScope
+ *  measures from its construction to the end of its block and adds the
+ *  cycles to its slot, scopes nest and may run in interrupts since the
+ *  counter is never reset or stopped. Every slot keeps count, min, max,
+ *  the sum and a histogram with one bin per power of two.
+ *
+ *  On the target the counter is the DWT cycle counter, which stops while the
+ *  core sleeps in WFI. Built for the host the same code counts nanoseconds of
+ *  std::chrono::steady_clock, or TSC ticks with TIMING_HOST_TSC, so the
+ *  instrumentation compiles into host tests and benchmarks unchanged.
+ */
+
+#ifndef INC_TIMING_SCOPE_H_
+#define INC_TIMING_SCOPE_H_
+
+#include <stdint.h>
+
+#define TIMING_SLOTS 16
+#define TIMING_HISTOGRAM_BINS 32 // Bin b counts durations in [2^b, 2^(b+1))
+
+struct TimingSlot {
+	const char* name;
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t sum;
+	uint32_t histogram[TIMING_HISTOGRAM_BINS];
+};
+
+// Enables the counter without resetting it, safe to call more than once
+void init_cycle_count(void);
+
+uint32_t cycle_count(void);
+
+// Index of the slot with this name, a new one if there is none yet. Returns -1
+// if all TIMING_SLOTS are taken. The name must stay valid.
+int timing_slot(const char* name);
+
+void timing_record(int slot, uint32_t cycles);
+
+const struct TimingSlot* timing_get_slot(int slot);
+int timing_slot_count(void);
+
+// Upper edge of the histogram bin that holds percent of the durations
+uint32_t timing_percentile(int slot, uint32_t percent);
+
+// Clears the statistics, the names stay
+void timing_reset(void);
+
+class TimingScope {
+public:
+	explicit TimingScope(int slot) : slot(slot), start(cycle_count()) {}
+	~TimingScope() { timing_record(slot, cycle_count() - start); }
+
+	uint32_t elapsed() const { return cycle_count() - start; }
+
+private:
+	int slot;
+	uint32_t start;
+};
+
+#endif /* INC_TIMING_SCOPE_H_ */
@@ -0,0 +1,76 @@
+/*
+ * token_log.h
+ *
+ *  Tokenized binary log. Instead of formatting text on the target a packet
+ *  carries the index of the format string in log_tokens.h, the HAL tick and
+ *  the raw 32 bit arguments, which Tests/token_decoder.py turns back into
+ *  text. Packet, little endian:
+ *
+ *    0xA5 | length | token | timestamp ms (4) | arguments (4 each) | checksum
+ *
+ *  The length counts token, timestamp and arguments, the checksum makes the
+ *  sum of length through checksum zero modulo 256. Plain text on the same
+ *  line is passed through by the decoder since 0xA5 is not ASCII.
+ *  Messages of the TFLite ErrorReporter use the token TOKEN_LOG_FORMAT and
+ *  carry the flash address of their format string instead, the decoder
+ *  reads it from the ELF file.
+ */
+
+#ifndef INC_TOKEN_LOG_H_
+#define INC_TOKEN_LOG_H_
+
+#include <stdarg.h>
+#include <stdint.h>
+#include "log_tokens.h"
+#include "tensorflow/lite/core/api/error_reporter.h"
+#include "tensorflow/lite/micro/compatibility.h"
+
+#define TOKEN_LOG_SYNC 0xA5
+#define TOKEN_LOG_FORMAT 0xFF // Format string address follows the timestamp
+#define TOKEN_LOG_MAX_ARGS 8
+#define TOKEN_LOG_PACKET_MAX (3 + 4 + 4 * (TOKEN_LOG_MAX_ARGS + 1) + 1)
+
+#define LOG_TOKEN_ENUM(name, format) name,
+#define LOG_TOKEN_FORMAT(name, format) format,
+
+enum LogToken {
+	LOG_TOKENS(LOG_TOKEN_ENUM)
+	LOG_TOKEN_COUNT
+};
+
+// Writes a packet of n int32 arguments taken from args into packet, which
+// holds TOKEN_LOG_PACKET_MAX bytes. Returns the packet length.
+int token_log_vpack(uint8_t* packet, uint8_t token, uint32_t timestamp_ms, int n, va_list args);
+
+// Packet for a printf style format string in flash. The arguments are read
+// according to its conversions, floats are sent as float32 bits and strings
+// as their address.
+int token_log_pack_format(uint8_t* packet, uint32_t timestamp_ms, const char* format, va_list args);
+
+typedef void (*TokenLogWrite)(const char* data, int length);
+
+// ErrorReporter for the interpreter that sends format packets
+class TokenErrorReporter : public tflite::ErrorReporter {
+public:
+	explicit TokenErrorReporter(TokenLogWrite write) : write_(write) {}
+	int Report(const char* format, va_list args) override;
+
+private:
+	TokenLogWrite write_;
+	TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+// ErrorReporter for the text log, formats the message and a line end on the
+// target. Unlike MicroErrorReporter it does not go through DebugLog, whose
+// blocking transmit fails while write queued a message for the DMA.
+class TextErrorReporter : public tflite::ErrorReporter {
+public:
+	explicit TextErrorReporter(TokenLogWrite write) : write_(write) {}
+	int Report(const char* format, va_list args) override;
+
+private:
+	TokenLogWrite write_;
+	TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+#endif /* INC_TOKEN_LOG_H_ */
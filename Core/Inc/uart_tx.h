@@ -0,0 +1,63 @@
+/*
+ * uart_tx.h
+ *
+ *  Non-blocking UART output. Messages are copied into a bounded queue of
+ *  fixed slots and sent one at a time by DMA, the next one is started from
+ *  the transmit complete interrupt. If the queue is full the oldest waiting
+ *  message is dropped and counted, so a slow link never stalls the caller.
+ *  Safe to call from the main loop and from interrupts below the priority
+ *  of the USART and its DMA channel. Large blocks, e.g. of feature_stream.h,
+ *  are sent from the caller's memory without a copy and ahead of the queue.
+ */
+
+#ifndef INC_UART_TX_H_
+#define INC_UART_TX_H_
+
+#define UART_TX_SLOTS 16
+#define UART_TX_SLOT_SIZE 96
+
+#include "stm32l4xx_hal.h"
+
+struct UartTxSlot {
+	uint16_t length;
+	char data[UART_TX_SLOT_SIZE];
+};
+
+struct UartTx {
+	USART_HandleTypeDef* husart;
+	struct UartTxSlot slots[UART_TX_SLOTS];
+	char dma_buffer[UART_TX_SLOT_SIZE]; // Message on the wire, its slot is free again
+	volatile uint32_t head;             // Next slot to fill
+	volatile uint32_t tail;             // Oldest waiting message
+	volatile bool busy;                 // A DMA transfer is running
+	volatile uint32_t sent;
+	volatile uint32_t dropped;          // Messages dropped because the queue was full
+	uint32_t truncated;                 // Messages cut to UART_TX_SLOT_SIZE
+	const uint8_t* volatile block;      // Waiting block of uart_tx_send_block
+	uint16_t block_length;
+	volatile bool block_busy;           // The DMA transfer running is a block
+};
+
+void init_uart_tx(struct UartTx* tx, USART_HandleTypeDef* husart);
+
+// Queues a copy of the text and returns immediately. Returns false if an older
+// message had to be dropped.
+bool uart_tx_write(struct UartTx* tx, const char* text, uint16_t length);
+
+// Like uart_tx_write with the time of the event in ms in front of the text
+bool uart_tx_event(struct UartTx* tx, uint32_t timestamp_ms, const char* text, uint16_t length);
+
+// Sends length bytes from data by DMA before the queued messages. Returns false
+// if the previous block is not out yet, data must stay unchanged until
+// uart_tx_block_done.
+bool uart_tx_send_block(struct UartTx* tx, const uint8_t* data, uint16_t length);
+
+bool uart_tx_block_done(const struct UartTx* tx);
+
+// Waits until every queued message is out, e.g. before a blocking transmit
+void uart_tx_flush(struct UartTx* tx);
+
+// Called from HAL_USART_TxCpltCallback and HAL_USART_ErrorCallback
+void uart_tx_complete(struct UartTx* tx);
+
+#endif /* INC_UART_TX_H_ */
@@ -0,0 +1,36 @@
+/*
+ * vad.h
+ *
+ *  Energy based voice activity detection used to skip inference while the
+ *  whole model window is quiet. The energy measure is the first (int8) MFCC,
+ *  i.e. the scaled sum of the log mel energies, which both front-ends produce
+ *  anyway. One step corresponds to roughly 1.2 dB of average band energy.
+ */
+
+#ifndef INC_VAD_H_
+#define INC_VAD_H_
+
+#include <arm_math.h>
+
+struct Vad {
+	int8_t threshold_on;  // Activity starts above this energy
+	int8_t threshold_off; // and ends hangover_rows after it drops below this one
+	uint16_t hangover_rows;
+	uint16_t hangover;
+	uint16_t quiet_rows;  // Consecutive rows without activity
+	bool active;
+	uint32_t inferences_run;
+	uint32_t inferences_skipped;
+};
+
+void init_vad(struct Vad* vad, int8_t threshold_on, int8_t threshold_off, uint16_t hangover_rows);
+
+// Feeds the mfccs of one new feature row, returns whether there is activity
+bool vad_update(struct Vad* vad, const int8_t* mfccs_int8);
+
+// True if none of the last window_rows rows showed activity
+bool vad_window_quiet(struct Vad* vad, uint16_t window_rows);
+
+void vad_count_inference(struct Vad* vad, bool skipped);
+
+#endif /* INC_VAD_H_ */
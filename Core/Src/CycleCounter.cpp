@@ -1,22 +1,30 @@
 #include "CycleCounter.h"
+#include "timing_scope.h"
+
+static unsigned int accumulated = 0; // Cycles of the finished intervals
+static unsigned int started = 0;
+static bool running = false;
 
 void ResetTimer(){
-	DWT_CYCCNT   = (unsigned int *)0xE0001004; //address of the register
-	DWT_CONTROL  = (unsigned int *)0xE0001000; //address of the register
-	SCB_DEMCR    = (unsigned int *)0xE000EDFC; //address of the register
-	*SCB_DEMCR   = *SCB_DEMCR | 0x01000000;
-	*DWT_CYCCNT  = 0; // reset the counter
-	*DWT_CONTROL = 0; 
+	init_cycle_count();
+	accumulated = 0;
+	running = false;
 }
 
 void StartTimer(){
-	*DWT_CONTROL = *DWT_CONTROL | 1 ; // enable the counter
+	if(!running){
+		started = cycle_count();
+		running = true;
+	}
 }
 
 void StopTimer(){
-	*DWT_CONTROL = *DWT_CONTROL & 0 ; // disable the counter    
+	if(running){
+		accumulated += cycle_count() - started;
+		running = false;
+	}
 }
 
 unsigned int getCycles(){
-	return *DWT_CYCCNT;
+	return running ? accumulated + (cycle_count() - started) : accumulated;
 }
@@ -1,4 +1,5 @@
 #include "ben_dct2_f32.h"
+#include "frontend_tables.h"
 #include <arm_math.h>
 
 void ben_dct2_f32(float32_t* pInlineBuffer, float32_t* pState, float32_t* mfcc_out, arm_rfft_fast_instance_f32* pRfft){
@@ -7,7 +8,7 @@ void ben_dct2_f32(float32_t* pInlineBuffer, float32_t* pState, float32_t* mfcc_o
 	const float32_t normalize = 0.17677669529663689; // sqrt(2/N)
 
 	// Big precalculated coefficients table (or multipy by 2?)
-	float32_t Weights_64[128]=
+	static const float32_t Weights_64[128]=
 	{
 			0.5, 0.0, 0.4998494093481021, -0.012270614261456144, 0.4993977281025862, -0.024533837163709007, 0.4986452283393451, -0.03678228179983371,
 			0.49759236333609846, -0.0490085701647803, 0.496239767299355, -0.0612053375996081, 0.4945882549823905, -0.07336523722768087, 0.4926388211944706, -0.08548094438015061,
@@ -112,3 +113,26 @@ void ben_dct2_f32(float32_t* pInlineBuffer, float32_t* pState, float32_t* mfcc_o
 	}
 
 }
+
+void dct2_truncated_f32(const float32_t* log_mel_spectrogram, float32_t* mfcc_out){
+	for(int k = 0; k < N_MFCC_COEFFS; k++){
+		arm_dot_prod_f32(log_mel_spectrogram, &dct2_basis_f32[k * N_MEL_BANDS], N_MEL_BANDS, &mfcc_out[k]);
+	}
+}
+
+void dct2_truncated_int8(const float32_t* log_mel_spectrogram, int8_t* mfccs_int8){
+	float32_t mfcc;
+	for(int k = 0; k < N_MFCC_COEFFS; k++){
+		arm_dot_prod_f32(log_mel_spectrogram, &dct2_basis_int8_f32[k * N_MEL_BANDS], N_MEL_BANDS, &mfcc);
+		mfcc += dct2_bias_int8_f32;
+
+		// Truncate towards zero like the cast in normalize_mfccs, but saturate
+		if(mfcc >= 127.0f){
+			mfccs_int8[k] = 127;
+		} else if(mfcc <= -128.0f){
+			mfccs_int8[k] = -128;
+		} else {
+			mfccs_int8[k] = (int8_t)mfcc;
+		}
+	}
+}
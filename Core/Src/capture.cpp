@@ -0,0 +1,71 @@
+/*
+ * capture.cpp
+ *
+ *  Low latency DMA reader, see capture.h
+ */
+
+#include "capture.h"
+
+void init_capture(struct Capture* capture, const int32_t* buffer, uint16_t length){
+	capture->buffer = buffer;
+	capture->length = length;
+	capture->written = 0;
+	capture->read = 0;
+	capture->overruns = 0;
+	capture->dropped = 0;
+}
+
+uint32_t capture_update(struct Capture* capture, uint32_t passes, uint16_t remaining){
+	uint32_t written = passes * capture->length + (capture->length - remaining);
+
+	// Counter already reloaded, pass not counted yet
+	if(written < capture->written){
+		written += capture->length;
+	}
+	capture->written = written;
+
+	return written;
+}
+
+uint16_t capture_next_block(struct Capture* capture, uint16_t min_block, const int32_t** block){
+	uint32_t available = capture->written - capture->read;
+
+	// Resynchronize half a buffer behind the DMA
+	if(available > capture->length){
+		uint32_t skip = available - capture->length / 2;
+		capture->read += skip;
+		capture->dropped += skip;
+		capture->overruns++;
+		available -= skip;
+	}
+
+	if(available < min_block){
+		return 0;
+	}
+
+	uint16_t start = capture->read % capture->length;
+	uint16_t n = capture->length - start;
+	if(available < n){
+		n = available;
+	}
+
+	*block = &capture->buffer[start];
+	return n;
+}
+
+bool capture_check_late(struct Capture* capture){
+	// The sample at read is overwritten once the DMA is a whole buffer ahead of it
+	if(capture->written - capture->read > capture->length){
+		capture->overruns++;
+		return true;
+	}
+	return false;
+}
+
+void capture_consume(struct Capture* capture, uint16_t n){
+	capture->read += n;
+}
+
+uint16_t capture_write_position(struct Capture* capture){
+	return capture->written % capture->length;
+}
@@ -0,0 +1,69 @@
+/*
+ * detector.cpp
+ *
+ *  Posterior smoothing and per class thresholds, see detector.h
+ */
+
+#include "detector.h"
+
+void init_detector(struct Detector* detector, enum DetectorSmoothing smoothing, uint8_t length, const int8_t* thresholds){
+	detector->smoothing = smoothing;
+	detector->length = (length < 1) ? 1 : (length > DETECTOR_HISTORY_MAX) ? DETECTOR_HISTORY_MAX : length;
+	for(int c = 0; c < DETECTOR_CLASSES; c++){
+		detector->thresholds[c] = thresholds[c];
+	}
+	detector_reset(detector);
+}
+
+void detector_reset(struct Detector* detector){
+	detector->count = 0;
+	detector->next = 0;
+	for(int c = 0; c < DETECTOR_CLASSES; c++){
+		detector->scores[c] = -128;
+	}
+}
+
+int detector_update(struct Detector* detector, const int8_t* output){
+	for(int c = 0; c < DETECTOR_CLASSES; c++){
+		detector->history[detector->next][c] = output[c];
+	}
+	detector->next = (detector->next + 1) % detector->length;
+	if(detector->count < detector->length){
+		detector->count++;
+	}
+
+	for(int c = 0; c < DETECTOR_CLASSES; c++){
+		int32_t score = (detector->smoothing == SMOOTHING_MAX) ? -128 : 0;
+		for(int i = 0; i < detector->count; i++){
+			if(detector->smoothing == SMOOTHING_MAX){
+				score = (detector->history[i][c] > score) ? detector->history[i][c] : score;
+			} else {
+				score += detector->history[i][c];
+			}
+		}
+		if(detector->smoothing == SMOOTHING_MEAN){
+			// Floor division, the mean of int8 values stays in range
+			score = (score >= 0) ? score / detector->count : -((-score + detector->count - 1) / detector->count);
+		}
+		detector->scores[c] = (int8_t)score;
+	}
+
+	// Unique maximum, ties are no decision like in the plain argmax before
+	int best = DETECTOR_NONE;
+	for(int c = 0; c < DETECTOR_CLASSES; c++){
+		bool unique = true;
+		for(int other = 0; other < DETECTOR_CLASSES; other++){
+			if(other != c && detector->scores[other] >= detector->scores[c]){
+				unique = false;
+			}
+		}
+		if(unique){
+			best = c;
+		}
+	}
+
+	if(best != DETECTOR_NONE && detector->scores[best] < detector->thresholds[best]){
+		return DETECTOR_NONE;
+	}
+	return best;
+}
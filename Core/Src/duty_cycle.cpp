@@ -0,0 +1,46 @@
+/*
+ * duty_cycle.cpp
+ *
+ *  Sleep and active time accounting, see duty_cycle.h
+ */
+
+#include "duty_cycle.h"
+
+void init_duty_cycle(struct DutyCycle* duty_cycle, uint32_t period_ms, uint32_t cycles_per_ms, uint32_t now_ms){
+	duty_cycle->period_ms = period_ms;
+	duty_cycle->cycles_per_ms = cycles_per_ms;
+	duty_cycle->period_start_ms = now_ms;
+	duty_cycle->sleep_cycles = 0;
+	duty_cycle->wakeups = 0;
+}
+
+void duty_cycle_add_sleep(struct DutyCycle* duty_cycle, uint32_t cycles){
+	duty_cycle->sleep_cycles += cycles;
+	duty_cycle->wakeups++;
+}
+
+bool duty_cycle_period_finished(struct DutyCycle* duty_cycle, uint32_t now_ms, struct DutyCycleReport* report){
+	uint32_t elapsed_ms = now_ms - duty_cycle->period_start_ms;
+	if(elapsed_ms < duty_cycle->period_ms){
+		return false;
+	}
+
+	report->total_cycles = (uint64_t)elapsed_ms * duty_cycle->cycles_per_ms;
+	// The tick has only millisecond resolution, the sleep cycles are exact
+	report->sleep_cycles = duty_cycle->sleep_cycles < report->total_cycles ? duty_cycle->sleep_cycles : report->total_cycles;
+	report->wakeups = duty_cycle->wakeups;
+	report->active_permille = (uint32_t)((report->total_cycles - report->sleep_cycles) * 1000 / report->total_cycles);
+
+	duty_cycle->period_start_ms = now_ms;
+	duty_cycle->sleep_cycles = 0;
+	duty_cycle->wakeups = 0;
+	return true;
+}
+
+uint32_t down_counter_elapsed(uint32_t before, uint32_t after, uint32_t period){
+	return (before + period - after) % period;
+}
+
+bool may_sleep(bool block_pending, bool inference_due, bool frontend_in_loop){
+	return !inference_due && !(frontend_in_loop && block_pending);
+}
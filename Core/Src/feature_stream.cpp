@@ -0,0 +1,124 @@
+/*
+ * feature_stream.cpp
+ *
+ *  Framing of the front-end stages, see feature_stream.h
+ */
+
+#include "feature_stream.h"
+#include <string.h>
+
+#define HEADER_SIZE 12
+#define SECTION_HEADER_SIZE 4
+
+// CRC-32 as zlib, a nibble at a time to keep the table small
+static const uint32_t crc32_nibbles[16] = {
+	0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+	0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+
+static uint32_t crc32(const uint8_t* data, uint32_t length){
+	uint32_t crc = 0xFFFFFFFF;
+	for(uint32_t i = 0; i < length; i++){
+		crc ^= data[i];
+		crc = (crc >> 4) ^ crc32_nibbles[crc & 0x0F];
+		crc = (crc >> 4) ^ crc32_nibbles[crc & 0x0F];
+	}
+	return ~crc;
+}
+
+static void put_u16(uint8_t* data, uint16_t value){
+	data[0] = value & 0xFF;
+	data[1] = value >> 8;
+}
+
+static void put_u32(uint8_t* data, uint32_t value){
+	put_u16(data, value & 0xFFFF);
+	put_u16(&data[2], value >> 16);
+}
+
+// Appends a section header and returns where its values go, NULL if the stage
+// is not selected or does not fit
+static uint8_t* feature_stream_section(struct FeatureStream* stream, enum FeatureStreamStage stage,
+		enum FeatureStreamType type, uint16_t n, uint16_t bytes){
+	if(!feature_stream_wants(stream, stage) ||
+			stream->length + SECTION_HEADER_SIZE + bytes + 4 > FEATURE_STREAM_RECORD_SIZE){
+		return NULL;
+	}
+	uint8_t* record = stream->records[stream->filling];
+	uint8_t* section = &record[stream->length];
+	section[0] = stage;
+	section[1] = type;
+	put_u16(&section[2], n);
+	stream->length += SECTION_HEADER_SIZE + bytes;
+	return &section[SECTION_HEADER_SIZE];
+}
+
+void init_feature_stream(struct FeatureStream* stream, struct UartTx* tx, uint16_t stages){
+	stream->tx = tx;
+	stream->stages = stages;
+	stream->filling = 0;
+	stream->length = HEADER_SIZE;
+	stream->sequence = 0;
+	stream->flags = 0;
+	stream->sent = 0;
+	stream->dropped = 0;
+}
+
+void feature_stream_begin(struct FeatureStream* stream){
+	stream->length = HEADER_SIZE;
+}
+
+bool feature_stream_wants(const struct FeatureStream* stream, enum FeatureStreamStage stage){
+	return (stream->stages & STREAM_STAGE(stage)) != 0;
+}
+
+void feature_stream_add_audio(struct FeatureStream* stream, const int32_t* samples, uint16_t n){
+	uint8_t* values = feature_stream_section(stream, STREAM_AUDIO, STREAM_TYPE_INT16, n, 2 * n);
+	if(values == NULL){
+		return;
+	}
+	for(uint16_t i = 0; i < n; i++){
+		// 16 significant bits with sinc3, oversampling 64 and the right shift of 3
+		put_u16(&values[2 * i], (uint16_t)__SSAT(samples[i] >> 8, 16));
+	}
+}
+
+void feature_stream_add_f32(struct FeatureStream* stream, enum FeatureStreamStage stage,
+		const float32_t* values, uint16_t n){
+	uint8_t* data = feature_stream_section(stream, stage, STREAM_TYPE_FLOAT32, n, 4 * n);
+	if(data != NULL){
+		// The Cortex-M4 is little endian like the record
+		memcpy(data, values, 4 * n);
+	}
+}
+
+void feature_stream_add_int8(struct FeatureStream* stream, const int8_t* values, uint16_t n){
+	uint8_t* data = feature_stream_section(stream, STREAM_INT8, STREAM_TYPE_INT8, n, n);
+	if(data != NULL){
+		memcpy(data, values, n);
+	}
+}
+
+void feature_stream_mark_discontinuity(struct FeatureStream* stream){
+	stream->flags |= FEATURE_STREAM_DISCONTINUITY;
+}
+
+bool feature_stream_end(struct FeatureStream* stream){
+	uint8_t* record = stream->records[stream->filling];
+	put_u32(&record[0], FEATURE_STREAM_MAGIC);
+	put_u32(&record[4], stream->sequence++);
+	put_u16(&record[8], stream->flags);
+	put_u16(&record[10], stream->length - HEADER_SIZE);
+	put_u32(&record[stream->length], crc32(record, stream->length));
+
+	// The other record is free once the previous block is out
+	if(!uart_tx_send_block(stream->tx, record, stream->length + 4)){
+		// The flag stays for the next record that makes it
+		stream->dropped++;
+		return false;
+	}
+	stream->flags = 0;
+	stream->filling ^= 1;
+	stream->sent++;
+	return true;
+}
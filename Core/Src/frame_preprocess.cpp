@@ -0,0 +1,26 @@
+/*
+ * frame_preprocess.cpp
+ *
+ *  Fused conversion, pre-emphasis and windowing, see frame_preprocess.h
+ */
+
+#include "frame_preprocess.h"
+
+void preprocess_frame_f32(const int32_t* samples, float32_t* frame, uint32_t frame_length,
+		float32_t pre_emphasis, const float32_t* window){
+	float32_t prev = (float32_t)(samples[0] >> 8);
+
+	if(window != NULL){
+		for(uint32_t i = 0; i < frame_length; i++){
+			float32_t x = (float32_t)(samples[i] >> 8);
+			frame[i] = (x - pre_emphasis * prev) * window[i];
+			prev = x;
+		}
+	} else {
+		for(uint32_t i = 0; i < frame_length; i++){
+			float32_t x = (float32_t)(samples[i] >> 8);
+			frame[i] = x - pre_emphasis * prev;
+			prev = x;
+		}
+	}
+}
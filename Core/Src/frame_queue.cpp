@@ -0,0 +1,72 @@
+/*
+ * frame_queue.cpp
+ *
+ *  SPSC queue between the DMA callbacks and the main loop, see frame_queue.h
+ */
+
+#include "frame_queue.h"
+
+void init_frame_queue(struct FrameQueue* queue){
+	queue->head = 0;
+	queue->tail = 0;
+	queue->next_sequence = 0;
+	queue->overruns = 0;
+	queue->expected_sequence = 0;
+	queue->gaps = 0;
+	queue->lost = 0;
+	queue->late = 0;
+}
+
+bool frame_queue_push(struct FrameQueue* queue, const int32_t* samples, uint16_t length){
+	uint32_t sequence = queue->next_sequence;
+	queue->next_sequence = sequence + 1;
+
+	uint32_t head = queue->head;
+	if(head - queue->tail == FRAME_QUEUE_LENGTH){
+		queue->overruns++;
+		return false;
+	}
+
+	struct FrameDescriptor* entry = &queue->entries[head % FRAME_QUEUE_LENGTH];
+	entry->sequence = sequence;
+	entry->samples = samples;
+	entry->length = length;
+
+	// The entry has to be complete before the consumer can see it
+	__DMB();
+	queue->head = head + 1;
+	return true;
+}
+
+bool frame_queue_pop(struct FrameQueue* queue, struct FrameDescriptor* frame, uint32_t* missed){
+	uint32_t tail = queue->tail;
+	if(queue->head == tail){
+		return false;
+	}
+
+	__DMB();
+	*frame = queue->entries[tail % FRAME_QUEUE_LENGTH];
+	__DMB();
+	queue->tail = tail + 1;
+
+	*missed = frame->sequence - queue->expected_sequence;
+	if(*missed > 0){
+		queue->gaps++;
+		queue->lost += *missed;
+	}
+	queue->expected_sequence = frame->sequence + 1;
+	return true;
+}
+
+bool frame_queue_pending(const struct FrameQueue* queue){
+	return queue->head != queue->tail;
+}
+
+bool frame_queue_check_late(struct FrameQueue* queue, const struct FrameDescriptor* frame, uint32_t segments){
+	// Once the next segments - 1 blocks are complete the DMA is back in this one
+	if(queue->next_sequence - frame->sequence >= segments){
+		queue->late++;
+		return true;
+	}
+	return false;
+}
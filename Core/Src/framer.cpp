@@ -0,0 +1,39 @@
+/*
+ * framer.cpp
+ *
+ *  Streaming framer, see framer.h
+ */
+
+#include "framer.h"
+#include <string.h>
+
+void init_framer(struct Framer* framer, uint16_t hop){
+	framer->count = 0;
+	framer->hop = (hop > 0 && hop <= FRAME_LENGTH) ? hop : FRAME_LENGTH;
+}
+
+uint16_t framer_push(struct Framer* framer, const int32_t* samples, uint16_t n){
+	uint16_t space = FRAME_LENGTH - framer->count;
+	uint16_t num = (n < space) ? n : space;
+
+	memcpy(&framer->samples[framer->count], samples, num * sizeof(int32_t));
+	framer->count += num;
+
+	return num;
+}
+
+bool framer_frame_ready(struct Framer* framer){
+	return framer->count == FRAME_LENGTH;
+}
+
+void framer_advance(struct Framer* framer){
+	uint16_t keep = FRAME_LENGTH - framer->hop;
+
+	// The overlap is kept at the start of the frame so every frame is contiguous
+	memmove(framer->samples, &framer->samples[framer->hop], keep * sizeof(int32_t));
+	framer->count = keep;
+}
+
+void framer_reset(struct Framer* framer){
+	framer->count = 0;
+}
@@ -0,0 +1,763 @@
+// Generated by Precalculations/calc_frontend_tables.py, do not edit.
+
+#include "frontend_tables.h"
+
+const struct MelBand mel_bands[N_MEL_BANDS] = {
+	{9, 5, 0}, {12, 5, 5}, {14, 6, 10}, {17, 6, 16},
+	{20, 5, 22}, {23, 5, 27}, {25, 7, 32}, {28, 7, 39},
+	{32, 6, 46}, {35, 7, 52}, {38, 7, 59}, {42, 7, 66},
+	{45, 7, 73}, {49, 7, 80}, {52, 8, 87}, {56, 8, 95},
+	{60, 8, 103}, {64, 9, 111}, {68, 9, 120}, {73, 9, 129},
+	{77, 9, 138}, {82, 9, 147}, {86, 10, 156}, {91, 11, 166},
+	{96, 11, 177}, {102, 10, 188}, {107, 11, 198}, {112, 12, 209},
+	{118, 12, 221}, {124, 12, 233}, {130, 12, 245}, {136, 13, 257},
+	{142, 14, 270}, {149, 14, 284}, {156, 14, 298}, {163, 14, 312},
+	{170, 15, 326}, {177, 16, 341}, {185, 16, 357}, {193, 16, 373},
+	{201, 17, 389}, {209, 17, 406}, {218, 18, 423}, {226, 19, 441},
+	{236, 19, 460}, {245, 19, 479}, {255, 20, 498}, {264, 21, 518},
+	{275, 21, 539}, {285, 22, 560}, {296, 23, 582}, {307, 24, 605},
+	{319, 24, 629}, {331, 25, 653}, {343, 26, 678}, {356, 26, 704},
+	{369, 27, 730}, {382, 28, 757}, {396, 29, 785}, {410, 30, 814},
+	{425, 30, 844}, {440, 31, 874}, {455, 33, 905}, {471, 34, 938}
+};
+
+const float32_t mel_weights_f32[N_MEL_WEIGHTS] = {
+	0.166302f, 0.563328f, 0.955716f, 0.656423f, 0.272992f, 0.343577f, 0.727008f, 0.893888f, 0.519015f, 0.148278f,
+	0.106112f, 0.480985f, 0.851722f, 0.781588f, 0.418859f, 0.060003f, 0.218412f, 0.581141f, 0.939997f, 0.704941f,
+	0.353587f, 0.005875f, 0.295059f, 0.646413f, 0.994125f, 0.661725f, 0.321064f, 0.338275f, 0.678936f, 0.983823f,
+	0.649933f, 0.319328f, 0.016177f, 0.350067f, 0.680672f, 0.991947f, 0.667726f, 0.346603f, 0.028520f, 0.008053f,
+	0.332274f, 0.653397f, 0.971480f, 0.713422f, 0.401253f, 0.091956f, 0.286578f, 0.598747f, 0.908044f, 0.785481f,
+	0.481775f, 0.180793f, 0.214519f, 0.518225f, 0.819207f, 0.882485f, 0.586798f, 0.293693f, 0.003121f, 0.117515f,
+	0.413202f, 0.706307f, 0.996879f, 0.715043f, 0.429417f, 0.146195f, 0.284957f, 0.570583f, 0.853805f, 0.865343f,
+	0.586818f, 0.310584f, 0.036604f, 0.134657f, 0.413182f, 0.689416f, 0.963396f, 0.764840f, 0.495253f, 0.227817f,
+	0.235160f, 0.504747f, 0.772183f, 0.962492f, 0.699245f, 0.438044f, 0.178862f, 0.037508f, 0.300755f, 0.561956f,
+	0.821138f, 0.921662f, 0.666412f, 0.413093f, 0.161667f, 0.078338f, 0.333588f, 0.586908f, 0.838333f, 0.912110f,
+	0.664392f, 0.418489f, 0.174372f, 0.087890f, 0.335608f, 0.581511f, 0.825628f, 0.932018f, 0.691395f, 0.452487f,
+	0.215266f, 0.067982f, 0.308605f, 0.547513f, 0.784734f, 0.979709f, 0.745790f, 0.513490f, 0.282785f, 0.053648f,
+	0.020291f, 0.254210f, 0.486510f, 0.717215f, 0.946352f, 0.826069f, 0.600021f, 0.375484f, 0.152443f, 0.173931f,
+	0.399979f, 0.624516f, 0.847557f, 0.930862f, 0.710741f, 0.492049f, 0.274772f, 0.058893f, 0.069138f, 0.289259f,
+	0.507951f, 0.725228f, 0.941107f, 0.844388f, 0.631247f, 0.419451f, 0.208983f, 0.155612f, 0.368753f, 0.580549f,
+	0.791017f, 0.999824f, 0.791955f, 0.585370f, 0.380046f, 0.175967f, 0.000176f, 0.208045f, 0.414630f, 0.619954f,
+	0.824033f, 0.973124f, 0.771495f, 0.571070f, 0.371835f, 0.173773f, 0.026876f, 0.228505f, 0.428930f, 0.628165f,
+	0.826227f, 0.976876f, 0.781122f, 0.586502f, 0.393006f, 0.200616f, 0.009322f, 0.023124f, 0.218878f, 0.413497f,
+	0.606994f, 0.799384f, 0.990678f, 0.819111f, 0.629972f, 0.441889f, 0.254855f, 0.068854f, 0.180889f, 0.370028f,
+	0.558111f, 0.745145f, 0.931146f, 0.883879f, 0.699917f, 0.516958f, 0.334989f, 0.154002f, 0.116121f, 0.300083f,
+	0.483042f, 0.665011f, 0.845998f, 0.973983f, 0.794925f, 0.616812f, 0.439639f, 0.263401f, 0.088079f, 0.026017f,
+	0.205075f, 0.383188f, 0.560361f, 0.736599f, 0.911921f, 0.913671f, 0.740158f, 0.567540f, 0.395807f, 0.224943f,
+	0.054945f, 0.086329f, 0.259842f, 0.432460f, 0.604193f, 0.775057f, 0.945055f, 0.885802f, 0.717507f, 0.550053f,
+	0.383428f, 0.217625f, 0.052638f, 0.114198f, 0.282493f, 0.449947f, 0.616572f, 0.782375f, 0.947362f, 0.888455f,
+	0.725068f, 0.562475f, 0.400668f, 0.239636f, 0.079368f, 0.111545f, 0.274932f, 0.437525f, 0.599332f, 0.760364f,
+	0.920632f, 0.919864f, 0.761114f, 0.603105f, 0.445843f, 0.289312f, 0.133505f, 0.080136f, 0.238886f, 0.396895f,
+	0.554157f, 0.710688f, 0.866495f, 0.978419f, 0.824042f, 0.670371f, 0.517402f, 0.365129f, 0.213543f, 0.062633f,
+	0.021581f, 0.175958f, 0.329629f, 0.482598f, 0.634871f, 0.786457f, 0.937366f, 0.912401f, 0.762838f, 0.613941f,
+	0.465696f, 0.318102f, 0.171159f, 0.024853f, 0.087599f, 0.237162f, 0.386059f, 0.534304f, 0.681898f, 0.828841f,
+	0.975147f, 0.879180f, 0.734136f, 0.589718f, 0.445916f, 0.302724f, 0.160144f, 0.018168f, 0.120820f, 0.265864f,
+	0.410282f, 0.554084f, 0.697276f, 0.839856f, 0.981832f, 0.876785f, 0.735995f, 0.595799f, 0.456181f, 0.317141f,
+	0.178673f, 0.040772f, 0.123215f, 0.264005f, 0.404201f, 0.543819f, 0.682859f, 0.821327f, 0.959228f, 0.903443f,
+	0.766666f, 0.630447f, 0.494769f, 0.359649f, 0.225063f, 0.091019f, 0.096557f, 0.233334f, 0.369553f, 0.505231f,
+	0.640351f, 0.774937f, 0.908981f, 0.957503f, 0.824519f, 0.692059f, 0.560119f, 0.428692f, 0.297782f, 0.167377f,
+	0.037475f, 0.042497f, 0.175481f, 0.307941f, 0.439881f, 0.571308f, 0.702218f, 0.832623f, 0.962525f, 0.908078f,
+	0.779173f, 0.650762f, 0.522842f, 0.395403f, 0.268447f, 0.141972f, 0.015970f, 0.091922f, 0.220827f, 0.349238f,
+	0.477158f, 0.604597f, 0.731553f, 0.858028f, 0.984030f, 0.890438f, 0.765375f, 0.640773f, 0.516634f, 0.392954f,
+	0.269725f, 0.146943f, 0.024612f, 0.109562f, 0.234625f, 0.359227f, 0.483366f, 0.607046f, 0.730275f, 0.853057f,
+	0.975388f, 0.902726f, 0.781272f, 0.660266f, 0.539693f, 0.419546f, 0.299828f, 0.180539f, 0.061669f, 0.097274f,
+	0.218728f, 0.339734f, 0.460307f, 0.580454f, 0.700172f, 0.819461f, 0.938331f, 0.943221f, 0.825188f, 0.707566f,
+	0.590352f, 0.473552f, 0.357152f, 0.241161f, 0.125562f, 0.010363f, 0.056779f, 0.174812f, 0.292434f, 0.409648f,
+	0.526448f, 0.642848f, 0.758839f, 0.874438f, 0.989637f, 0.895554f, 0.781141f, 0.667114f, 0.553469f, 0.440214f,
+	0.327337f, 0.214838f, 0.102714f, 0.104446f, 0.218859f, 0.332886f, 0.446531f, 0.559786f, 0.672663f, 0.785162f,
+	0.897286f, 0.990961f, 0.879580f, 0.768562f, 0.657919f, 0.547633f, 0.437714f, 0.328144f, 0.218939f, 0.110083f,
+	0.001583f, 0.009039f, 0.120420f, 0.231438f, 0.342081f, 0.452367f, 0.562286f, 0.671856f, 0.781061f, 0.889917f,
+	0.998417f, 0.893425f, 0.785620f, 0.678158f, 0.571037f, 0.464259f, 0.357822f, 0.251717f, 0.145946f, 0.040510f,
+	0.106575f, 0.214380f, 0.321842f, 0.428963f, 0.535741f, 0.642178f, 0.748283f, 0.854054f, 0.959490f, 0.935405f,
+	0.830621f, 0.726171f, 0.622034f, 0.518232f, 0.414739f, 0.311566f, 0.208710f, 0.106171f, 0.003941f, 0.064595f,
+	0.169379f, 0.273829f, 0.377966f, 0.481768f, 0.585261f, 0.688434f, 0.791290f, 0.893829f, 0.996059f, 0.902023f,
+	0.800412f, 0.699102f, 0.598102f, 0.497404f, 0.397011f, 0.296910f, 0.197114f, 0.097609f, 0.097976f, 0.199588f,
+	0.300898f, 0.401898f, 0.502596f, 0.602989f, 0.703090f, 0.802886f, 0.902391f, 0.998399f, 0.899476f, 0.800852f,
+	0.702512f, 0.604463f, 0.506693f, 0.409212f, 0.312010f, 0.215093f, 0.118444f, 0.022087f, 0.001601f, 0.100524f,
+	0.199148f, 0.297488f, 0.395537f, 0.493307f, 0.590788f, 0.687990f, 0.784907f, 0.881556f, 0.977913f, 0.925992f,
+	0.830181f, 0.734636f, 0.639367f, 0.544363f, 0.449636f, 0.355164f, 0.260965f, 0.167021f, 0.073349f, 0.074008f,
+	0.169819f, 0.265364f, 0.360633f, 0.455637f, 0.550363f, 0.644836f, 0.739035f, 0.832979f, 0.926651f, 0.979929f,
+	0.886766f, 0.793869f, 0.701224f, 0.608836f, 0.516696f, 0.424818f, 0.333181f, 0.241801f, 0.150662f, 0.059773f,
+	0.020071f, 0.113234f, 0.206131f, 0.298776f, 0.391164f, 0.483304f, 0.575182f, 0.666820f, 0.758199f, 0.849338f,
+	0.940227f, 0.969125f, 0.878732f, 0.788568f, 0.698655f, 0.608975f, 0.519538f, 0.430342f, 0.341375f, 0.252648f,
+	0.164150f, 0.075886f, 0.030875f, 0.121268f, 0.211432f, 0.301345f, 0.391025f, 0.480462f, 0.569658f, 0.658625f,
+	0.747352f, 0.835850f, 0.924114f, 0.987858f, 0.900055f, 0.812482f, 0.725137f, 0.638019f, 0.551130f, 0.464459f,
+	0.378013f, 0.291790f, 0.205785f, 0.120002f, 0.034437f, 0.012142f, 0.099945f, 0.187518f, 0.274863f, 0.361981f,
+	0.448870f, 0.535541f, 0.621987f, 0.708210f, 0.794215f, 0.879998f, 0.965563f, 0.949087f, 0.863955f, 0.779038f,
+	0.694339f, 0.609851f, 0.525571f, 0.441509f, 0.357647f, 0.274004f, 0.190560f, 0.107332f, 0.024299f, 0.050913f,
+	0.136045f, 0.220962f, 0.305661f, 0.390148f, 0.474429f, 0.558491f, 0.642353f, 0.725996f, 0.809440f, 0.892668f,
+	0.975701f, 0.941482f, 0.858857f, 0.776447f, 0.694226f, 0.612217f, 0.530400f, 0.448787f, 0.367370f, 0.286146f,
+	0.205126f, 0.124288f, 0.043658f, 0.058518f, 0.141143f, 0.223553f, 0.305774f, 0.387783f, 0.469600f, 0.551213f,
+	0.632630f, 0.713854f, 0.794874f, 0.875712f, 0.956343f, 0.963212f, 0.882964f, 0.802901f, 0.723031f, 0.643353f,
+	0.563862f, 0.484555f, 0.405442f, 0.326511f, 0.247765f, 0.169205f, 0.090826f, 0.012626f, 0.036788f, 0.117036f,
+	0.197099f, 0.276969f, 0.356647f, 0.436138f, 0.515445f, 0.594558f, 0.673489f, 0.752235f, 0.830795f, 0.909174f,
+	0.987374f, 0.934619f, 0.856783f, 0.779129f, 0.701657f, 0.624355f, 0.547240f, 0.470299f, 0.393529f, 0.316941f,
+	0.240520f, 0.164274f, 0.088210f, 0.012306f, 0.065381f, 0.143217f, 0.220871f, 0.298343f, 0.375645f, 0.452760f,
+	0.529701f, 0.606471f, 0.683059f, 0.759480f, 0.835726f, 0.911790f, 0.987694f, 0.936581f, 0.861022f, 0.785635f,
+	0.710415f, 0.635366f, 0.560478f, 0.485760f, 0.411209f, 0.336819f, 0.262600f, 0.188541f, 0.114646f, 0.040910f,
+	0.063419f, 0.138978f, 0.214365f, 0.289585f, 0.364634f, 0.439522f, 0.514240f, 0.588791f, 0.663181f, 0.737400f,
+	0.811459f, 0.885354f, 0.959090f, 0.967339f, 0.893927f, 0.820680f, 0.747585f, 0.674650f, 0.601875f, 0.529261f,
+	0.456799f, 0.384490f, 0.312341f, 0.240346f, 0.168510f, 0.096819f, 0.025282f, 0.032661f, 0.106073f, 0.179320f,
+	0.252415f, 0.325350f, 0.398125f, 0.470739f, 0.543201f, 0.615510f, 0.687658f, 0.759654f, 0.831490f, 0.903181f,
+	0.974718f, 0.953897f, 0.882666f, 0.811587f, 0.740654f, 0.669874f, 0.599239f, 0.528757f, 0.458413f, 0.388222f,
+	0.318184f, 0.248284f, 0.178530f, 0.108921f, 0.039458f, 0.046103f, 0.117334f, 0.188413f, 0.259346f, 0.330126f,
+	0.400761f, 0.471243f, 0.541587f, 0.611778f, 0.681816f, 0.751716f, 0.821470f, 0.891079f, 0.960542f, 0.970133f,
+	0.900961f, 0.831928f, 0.763025f, 0.694275f, 0.625663f, 0.557190f, 0.488855f, 0.420658f, 0.352606f, 0.284686f,
+	0.216897f, 0.149253f, 0.081747f, 0.014373f, 0.029867f, 0.099039f, 0.168072f, 0.236975f, 0.305725f, 0.374337f,
+	0.442810f, 0.511145f, 0.579342f, 0.647394f, 0.715314f, 0.783103f, 0.850747f, 0.918253f, 0.985627f, 0.947129f,
+	0.880023f, 0.813056f, 0.746212f, 0.679507f, 0.612932f, 0.546489f, 0.480176f, 0.414002f, 0.347944f, 0.282025f,
+	0.216236f, 0.150571f, 0.085037f, 0.019627f, 0.052871f, 0.119977f, 0.186944f, 0.253788f, 0.320493f, 0.387068f,
+	0.453511f, 0.519824f, 0.585998f, 0.652056f, 0.717975f, 0.783764f, 0.849429f, 0.914963f, 0.980373f, 0.954349f,
+	0.889201f, 0.824170f, 0.759270f, 0.694493f, 0.629840f, 0.565311f, 0.500906f, 0.436624f, 0.372467f, 0.308432f,
+	0.244522f, 0.180728f, 0.117050f, 0.053504f, 0.045651f, 0.110799f, 0.175830f, 0.240730f, 0.305507f, 0.370160f,
+	0.434689f, 0.499094f, 0.563376f, 0.627533f, 0.691568f, 0.755478f, 0.819272f, 0.882950f, 0.946496f, 0.990074f,
+	0.926759f, 0.863569f, 0.800495f, 0.737537f, 0.674703f, 0.611979f, 0.549378f, 0.486886f, 0.424518f, 0.362259f,
+	0.300124f, 0.238090f, 0.176181f, 0.114380f, 0.052704f, 0.009926f, 0.073241f, 0.136431f, 0.199505f, 0.262463f,
+	0.325297f, 0.388021f, 0.450622f, 0.513114f, 0.575482f, 0.637741f, 0.699876f, 0.761910f, 0.823819f, 0.885620f,
+	0.947296f, 0.991129f, 0.929671f, 0.868322f, 0.807090f, 0.745966f, 0.684952f, 0.624055f, 0.563259f, 0.502580f,
+	0.442010f, 0.381549f, 0.321190f, 0.260947f, 0.200806f, 0.140775f, 0.080860f, 0.021039f, 0.008871f, 0.070329f,
+	0.131678f, 0.192910f, 0.254034f, 0.315048f, 0.375945f, 0.436741f, 0.497420f, 0.557990f, 0.618451f, 0.678810f,
+	0.739053f, 0.799194f, 0.859225f, 0.919140f, 0.978961f, 0.961328f, 0.901725f, 0.842225f, 0.782834f, 0.723537f,
+	0.664357f, 0.605279f, 0.546295f, 0.487428f, 0.428656f, 0.369985f, 0.311423f, 0.252956f, 0.194591f, 0.136336f,
+	0.078167f, 0.020115f
+};
+
+const q15_t mel_weights_q15[N_MEL_WEIGHTS] = {
+	5449, 18459, 31317, 21510, 8945, 11258, 23823, 29291, 17007, 4859, 3477, 15761,
+	27909, 25611, 13725, 1966, 7157, 19043, 30802, 23100, 11586, 193, 9668, 21182,
+	32575, 21683, 10521, 11085, 22247, 32238, 21297, 10464, 530, 11471, 22304, 32504,
+	21880, 11357, 935, 264, 10888, 21411, 31833, 23377, 13148, 3013, 9391, 19620,
+	29755, 25739, 15787, 5924, 7029, 16981, 26844, 28917, 19228, 9624, 102, 3851,
+	13540, 23144, 32666, 23431, 14071, 4791, 9337, 18697, 27977, 28356, 19229, 10177,
+	1199, 4412, 13539, 22591, 31569, 25062, 16228, 7465, 7706, 16540, 25303, 31539,
+	22913, 14354, 5861, 1229, 9855, 18414, 26907, 30201, 21837, 13536, 5298, 2567,
+	10931, 19232, 27470, 29888, 21771, 13713, 5714, 2880, 10997, 19055, 27054, 30540,
+	22656, 14827, 7054, 2228, 10112, 17941, 25714, 32103, 24438, 16826, 9266, 1758,
+	665, 8330, 15942, 23502, 31010, 27069, 19661, 12304, 4995, 5699, 13107, 20464,
+	27773, 30502, 23290, 16123, 9004, 1930, 2266, 9478, 16645, 23764, 30838, 27669,
+	20685, 13745, 6848, 5099, 12083, 19023, 25920, 32762, 25951, 19181, 12453, 5766,
+	6, 6817, 13587, 20315, 27002, 31887, 25280, 18713, 12184, 5694, 881, 7488,
+	14055, 20584, 27074, 32010, 25596, 19218, 12878, 6574, 305, 758, 7172, 13549,
+	19890, 26194, 32463, 26841, 20643, 14480, 8351, 2256, 5927, 12125, 18288, 24417,
+	30512, 28963, 22935, 16940, 10977, 5046, 3805, 9833, 15828, 21791, 27722, 31915,
+	26048, 20212, 14406, 8631, 2886, 853, 6720, 12556, 18362, 24137, 29882, 29939,
+	24253, 18597, 12970, 7371, 1800, 2829, 8515, 14171, 19798, 25397, 30968, 29026,
+	23511, 18024, 12564, 7131, 1725, 3742, 9257, 14744, 20204, 25637, 31043, 29113,
+	23759, 18431, 13129, 7852, 2601, 3655, 9009, 14337, 19639, 24916, 30167, 30142,
+	24940, 19763, 14609, 9480, 4375, 2626, 7828, 13005, 18159, 23288, 28393, 32061,
+	27002, 21967, 16954, 11965, 6997, 2052, 707, 5766, 10801, 15814, 20803, 25771,
+	30716, 29898, 24997, 20118, 15260, 10424, 5609, 814, 2870, 7771, 12650, 17508,
+	22344, 27159, 31954, 28809, 24056, 19324, 14612, 9920, 5248, 595, 3959, 8712,
+	13444, 18156, 22848, 27520, 32173, 28730, 24117, 19523, 14948, 10392, 5855, 1336,
+	4038, 8651, 13245, 17820, 22376, 26913, 31432, 29604, 25122, 20658, 16213, 11785,
+	7375, 2983, 3164, 7646, 12110, 16555, 20983, 25393, 29785, 31375, 27018, 22677,
+	18354, 14047, 9758, 5485, 1228, 1393, 5750, 10091, 14414, 18721, 23010, 27283,
+	31540, 29756, 25532, 21324, 17132, 12957, 8796, 4652, 523, 3012, 7236, 11444,
+	15636, 19811, 23972, 28116, 32245, 29178, 25080, 20997, 16929, 12876, 8838, 4815,
+	806, 3590, 7688, 11771, 15839, 19892, 23930, 27953, 31962, 29581, 25601, 21636,
+	17685, 13748, 9825, 5916, 2021, 3187, 7167, 11132, 15083, 19020, 22943, 26852,
+	30747, 30907, 27040, 23186, 19345, 15517, 11703, 7902, 4114, 340, 1861, 5728,
+	9582, 13423, 17251, 21065, 24866, 28654, 32428, 29346, 25596, 21860, 18136, 14425,
+	10726, 7040, 3366, 3422, 7172, 10908, 14632, 18343, 22042, 25728, 29402, 32472,
+	28822, 25184, 21559, 17945, 14343, 10753, 7174, 3607, 52, 296, 3946, 7584,
+	11209, 14823, 18425, 22015, 25594, 29161, 32716, 29276, 25743, 22222, 18712, 15213,
+	11725, 8248, 4782, 1327, 3492, 7025, 10546, 14056, 17555, 21043, 24520, 27986,
+	31441, 30651, 27218, 23795, 20383, 16981, 13590, 10209, 6839, 3479, 129, 2117,
+	5550, 8973, 12385, 15787, 19178, 22559, 25929, 29289, 32639, 29557, 26228, 22908,
+	19599, 16299, 13009, 9729, 6459, 3198, 3210, 6540, 9860, 13169, 16469, 19759,
+	23039, 26309, 29570, 32716, 29474, 26242, 23020, 19807, 16603, 13409, 10224, 7048,
+	3881, 724, 52, 3294, 6526, 9748, 12961, 16165, 19359, 22544, 25720, 28887,
+	32044, 30343, 27203, 24073, 20951, 17838, 14734, 11638, 8551, 5473, 2404, 2425,
+	5565, 8695, 11817, 14930, 18034, 21130, 24217, 27295, 30364, 32110, 29058, 26013,
+	22978, 19950, 16931, 13920, 10918, 7923, 4937, 1959, 658, 3710, 6755, 9790,
+	12818, 15837, 18848, 21850, 24845, 27831, 30809, 31756, 28794, 25840, 22894, 19955,
+	17024, 14101, 11186, 8279, 5379, 2487, 1012, 3974, 6928, 9874, 12813, 15744,
+	18667, 21582, 24489, 27389, 30281, 32370, 29493, 26623, 23761, 20907, 18059, 15219,
+	12387, 9561, 6743, 3932, 1128, 398, 3275, 6145, 9007, 11861, 14709, 17549,
+	20381, 23207, 26025, 28836, 31640, 31100, 28310, 25528, 22752, 19984, 17222, 14467,
+	11719, 8979, 6244, 3517, 796, 1668, 4458, 7240, 10016, 12784, 15546, 18301,
+	21049, 23789, 26524, 29251, 31972, 30850, 28143, 25443, 22748, 20061, 17380, 14706,
+	12038, 9376, 6722, 4073, 1431, 1918, 4625, 7325, 10020, 12707, 15388, 18062,
+	20730, 23392, 26046, 28695, 31337, 31563, 28933, 26309, 23692, 21081, 18477, 15878,
+	13286, 10699, 8119, 5545, 2976, 414, 1205, 3835, 6459, 9076, 11687, 14291,
+	16890, 19482, 22069, 24649, 27223, 29792, 32354, 30626, 28075, 25530, 22992, 20459,
+	17932, 15411, 12895, 10386, 7881, 5383, 2890, 403, 2142, 4693, 7238, 9776,
+	12309, 14836, 17357, 19873, 22382, 24887, 27385, 29878, 32365, 30690, 28214, 25744,
+	23279, 20820, 18366, 15917, 13474, 11037, 8605, 6178, 3757, 1341, 2078, 4554,
+	7024, 9489, 11948, 14402, 16851, 19294, 21731, 24163, 26590, 29011, 31427, 31698,
+	29292, 26892, 24497, 22107, 19722, 17343, 14968, 12599, 10235, 7876, 5522, 3173,
+	828, 1070, 3476, 5876, 8271, 10661, 13046, 15425, 17800, 20169, 22533, 24892,
+	27246, 29595, 31940, 31257, 28923, 26594, 24270, 21950, 19636, 17326, 15021, 12721,
+	10426, 8136, 5850, 3569, 1293, 1511, 3845, 6174, 8498, 10818, 13132, 15442,
+	17747, 20047, 22342, 24632, 26918, 29199, 31475, 31789, 29523, 27261, 25003, 22750,
+	20502, 18258, 16019, 13784, 11554, 9329, 7107, 4891, 2679, 471, 979, 3245,
+	5507, 7765, 10018, 12266, 14510, 16749, 18984, 21214, 23439, 25661, 27877, 30089,
+	32297, 31036, 28837, 26642, 24452, 22266, 20085, 17907, 15734, 13566, 11401, 9241,
+	7086, 4934, 2786, 643, 1732, 3931, 6126, 8316, 10502, 12683, 14861, 17034,
+	19202, 21367, 23527, 25682, 27834, 29982, 32125, 31272, 29137, 27006, 24880, 22757,
+	20639, 18524, 16414, 14307, 12205, 10107, 8012, 5922, 3835, 1753, 1496, 3631,
+	5762, 7888, 10011, 12129, 14244, 16354, 18461, 20563, 22661, 24756, 26846, 28933,
+	31015, 32443, 30368, 28297, 26231, 24168, 22109, 20053, 18002, 15954, 13911, 11871,
+	9834, 7802, 5773, 3748, 1727, 325, 2400, 4471, 6537, 8600, 10659, 12715,
+	14766, 16814, 18857, 20897, 22934, 24966, 26995, 29020, 31041, 32477, 30463, 28453,
+	26447, 24444, 22445, 20449, 18457, 16469, 14484, 12503, 10525, 8551, 6580, 4613,
+	2650, 689, 291, 2305, 4315, 6321, 8324, 10323, 12319, 14311, 16299, 18284,
+	20265, 22243, 24217, 26188, 28155, 30118, 32079, 31501, 29548, 27598, 25652, 23709,
+	21770, 19834, 17901, 15972, 14046, 12124, 10205, 8289, 6376, 4467, 2561, 659
+};
+
+const float32_t mel_power_offset_f32[N_MEL_BANDS] = {
+	4.805863488e-01f, 4.838275519e-01f, 4.964904978e-01f, 5.155151036e-01f, 5.355153619e-01f, 5.443306372e-01f, 5.627426434e-01f, 5.771551424e-01f,
+	5.880054442e-01f, 5.996883291e-01f, 6.298775192e-01f, 6.276219442e-01f, 6.526182045e-01f, 6.662797020e-01f, 6.784573627e-01f, 6.939627650e-01f,
+	7.081453445e-01f, 7.274734540e-01f, 7.383639483e-01f, 7.535142966e-01f, 7.670070606e-01f, 7.873293327e-01f, 7.974803102e-01f, 8.132602847e-01f,
+	8.307528734e-01f, 8.408852405e-01f, 8.602296476e-01f, 8.720040701e-01f, 8.883219851e-01f, 9.032104812e-01f, 9.168562519e-01f, 9.342673453e-01f,
+	9.463639268e-01f, 9.629263104e-01f, 9.780264118e-01f, 9.918582004e-01f, 1.007082708e+00f, 1.021720684e+00f, 1.037516356e+00f, 1.051950295e+00f,
+	1.065814037e+00f, 1.082136230e+00f, 1.096314629e+00f, 1.112169918e+00f, 1.125071675e+00f, 1.141604135e+00f, 1.156443572e+00f, 1.170490858e+00f,
+	1.185910034e+00f, 1.200329362e+00f, 1.215980249e+00f, 1.230137252e+00f, 1.245436533e+00f, 1.259945821e+00f, 1.275253905e+00f, 1.290112960e+00f,
+	1.304664244e+00f, 1.319770785e+00f, 1.334500955e+00f, 1.349629704e+00f, 1.364249872e+00f, 1.379332651e+00f, 1.394248383e+00f, 1.408931505e+00f
+};
+
+const float32_t hann_window_f32[WINDOW_LENGTH] = {
+	0.000000000e+00f, 9.412358699e-06f, 3.764908043e-05f, 8.470910209e-05f, 1.505906519e-04f, 2.352912495e-04f, 3.388077058e-04f, 4.611361237e-04f,
+	6.022718974e-04f, 7.622097134e-04f, 9.409435499e-04f, 1.138466678e-03f, 1.354771661e-03f, 1.589850354e-03f, 1.843693909e-03f, 2.116292766e-03f,
+	2.407636664e-03f, 2.717714633e-03f, 3.046514999e-03f, 3.394025383e-03f, 3.760232701e-03f, 4.145123165e-03f, 4.548682286e-03f, 4.970894869e-03f,
+	5.411745018e-03f, 5.871216135e-03f, 6.349290921e-03f, 6.845951378e-03f, 7.361178806e-03f, 7.894953807e-03f, 8.447256284e-03f, 9.018065445e-03f,
+	9.607359798e-03f, 1.021511716e-02f, 1.084131464e-02f, 1.148592867e-02f, 1.214893498e-02f, 1.283030861e-02f, 1.353002390e-02f, 1.424805451e-02f,
+	1.498437340e-02f, 1.573895286e-02f, 1.651176448e-02f, 1.730277915e-02f, 1.811196710e-02f, 1.893929787e-02f, 1.978474029e-02f, 2.064826255e-02f,
+	2.152983213e-02f, 2.242941585e-02f, 2.334697982e-02f, 2.428248952e-02f, 2.523590970e-02f, 2.620720449e-02f, 2.719633731e-02f, 2.820327092e-02f,
+	2.922796741e-02f, 3.027038820e-02f, 3.133049404e-02f, 3.240824503e-02f, 3.350360058e-02f, 3.461651946e-02f, 3.574695976e-02f, 3.689487893e-02f,
+	3.806023374e-02f, 3.924298033e-02f, 4.044307415e-02f, 4.166047004e-02f, 4.289512215e-02f, 4.414698400e-02f, 4.541600845e-02f, 4.670214774e-02f,
+	4.800535344e-02f, 4.932557648e-02f, 5.066276715e-02f, 5.201687512e-02f, 5.338784940e-02f, 5.477563838e-02f, 5.618018980e-02f, 5.760145078e-02f,
+	5.903936783e-02f, 6.049388679e-02f, 6.196495290e-02f, 6.345251079e-02f, 6.495650445e-02f, 6.647687724e-02f, 6.801357194e-02f, 6.956653068e-02f,
+	7.113569500e-02f, 7.272100582e-02f, 7.432240345e-02f, 7.593982760e-02f, 7.757321738e-02f, 7.922251128e-02f, 8.088764722e-02f, 8.256856251e-02f,
+	8.426519385e-02f, 8.597747737e-02f, 8.770534861e-02f, 8.944874250e-02f, 9.120759342e-02f, 9.298183515e-02f, 9.477140087e-02f, 9.657622323e-02f,
+	9.839623426e-02f, 1.002313654e-01f, 1.020815477e-01f, 1.039467113e-01f, 1.058267862e-01f, 1.077217014e-01f, 1.096313857e-01f, 1.115557672e-01f,
+	1.134947733e-01f, 1.154483312e-01f, 1.174163672e-01f, 1.193988073e-01f, 1.213955767e-01f, 1.234066005e-01f, 1.254318027e-01f, 1.274711073e-01f,
+	1.295244373e-01f, 1.315917156e-01f, 1.336728642e-01f, 1.357678048e-01f, 1.378764585e-01f, 1.399987460e-01f, 1.421345874e-01f, 1.442839021e-01f,
+	1.464466094e-01f, 1.486226278e-01f, 1.508118753e-01f, 1.530142696e-01f, 1.552297276e-01f, 1.574581661e-01f, 1.596995011e-01f, 1.619536482e-01f,
+	1.642205226e-01f, 1.665000388e-01f, 1.687921112e-01f, 1.710966534e-01f, 1.734135785e-01f, 1.757427995e-01f, 1.780842286e-01f, 1.804377776e-01f,
+	1.828033579e-01f, 1.851808805e-01f, 1.875702559e-01f, 1.899713941e-01f, 1.923842047e-01f, 1.948085969e-01f, 1.972444793e-01f, 1.996917603e-01f,
+	2.021503478e-01f, 2.046201491e-01f, 2.071010713e-01f, 2.095930210e-01f, 2.120959043e-01f, 2.146096271e-01f, 2.171340946e-01f, 2.196692119e-01f,
+	2.222148835e-01f, 2.247710135e-01f, 2.273375058e-01f, 2.299142636e-01f, 2.325011901e-01f, 2.350981877e-01f, 2.377051587e-01f, 2.403220049e-01f,
+	2.429486279e-01f, 2.455849287e-01f, 2.482308081e-01f, 2.508861665e-01f, 2.535509039e-01f, 2.562249199e-01f, 2.589081140e-01f, 2.616003850e-01f,
+	2.643016316e-01f, 2.670117521e-01f, 2.697306445e-01f, 2.724582064e-01f, 2.751943352e-01f, 2.779389277e-01f, 2.806918807e-01f, 2.834530906e-01f,
+	2.862224533e-01f, 2.889998646e-01f, 2.917852200e-01f, 2.945784145e-01f, 2.973793430e-01f, 3.001879001e-01f, 3.030039800e-01f, 3.058274767e-01f,
+	3.086582838e-01f, 3.114962949e-01f, 3.143414030e-01f, 3.171935011e-01f, 3.200524817e-01f, 3.229182373e-01f, 3.257906599e-01f, 3.286696413e-01f,
+	3.315550733e-01f, 3.344468471e-01f, 3.373448539e-01f, 3.402489846e-01f, 3.431591298e-01f, 3.460751800e-01f, 3.489970253e-01f, 3.519245559e-01f,
+	3.548576614e-01f, 3.577962314e-01f, 3.607401553e-01f, 3.636893223e-01f, 3.666436213e-01f, 3.696029410e-01f, 3.725671702e-01f, 3.755361971e-01f,
+	3.785099100e-01f, 3.814881970e-01f, 3.844709459e-01f, 3.874580443e-01f, 3.904493799e-01f, 3.934448400e-01f, 3.964443119e-01f, 3.994476826e-01f,
+	4.024548390e-01f, 4.054656679e-01f, 4.084800560e-01f, 4.114978898e-01f, 4.145190556e-01f, 4.175434398e-01f, 4.205709283e-01f, 4.236014074e-01f,
+	4.266347628e-01f, 4.296708803e-01f, 4.327096457e-01f, 4.357509446e-01f, 4.387946624e-01f, 4.418406845e-01f, 4.448888964e-01f, 4.479391831e-01f,
+	4.509914298e-01f, 4.540455218e-01f, 4.571013438e-01f, 4.601587810e-01f, 4.632177182e-01f, 4.662780402e-01f, 4.693396318e-01f, 4.724023778e-01f,
+	4.754661628e-01f, 4.785308715e-01f, 4.815963885e-01f, 4.846625984e-01f, 4.877293857e-01f, 4.907966350e-01f, 4.938642309e-01f, 4.969320577e-01f,
+	5.000000000e-01f, 5.030679423e-01f, 5.061357691e-01f, 5.092033650e-01f, 5.122706143e-01f, 5.153374016e-01f, 5.184036115e-01f, 5.214691285e-01f,
+	5.245338372e-01f, 5.275976222e-01f, 5.306603682e-01f, 5.337219598e-01f, 5.367822818e-01f, 5.398412190e-01f, 5.428986562e-01f, 5.459544782e-01f,
+	5.490085702e-01f, 5.520608169e-01f, 5.551111036e-01f, 5.581593155e-01f, 5.612053376e-01f, 5.642490554e-01f, 5.672903543e-01f, 5.703291197e-01f,
+	5.733652372e-01f, 5.763985926e-01f, 5.794290717e-01f, 5.824565602e-01f, 5.854809444e-01f, 5.885021102e-01f, 5.915199440e-01f, 5.945343321e-01f,
+	5.975451610e-01f, 6.005523174e-01f, 6.035556881e-01f, 6.065551600e-01f, 6.095506201e-01f, 6.125419557e-01f, 6.155290541e-01f, 6.185118030e-01f,
+	6.214900900e-01f, 6.244638029e-01f, 6.274328298e-01f, 6.303970590e-01f, 6.333563787e-01f, 6.363106777e-01f, 6.392598447e-01f, 6.422037686e-01f,
+	6.451423386e-01f, 6.480754441e-01f, 6.510029747e-01f, 6.539248200e-01f, 6.568408702e-01f, 6.597510154e-01f, 6.626551461e-01f, 6.655531529e-01f,
+	6.684449267e-01f, 6.713303587e-01f, 6.742093401e-01f, 6.770817627e-01f, 6.799475183e-01f, 6.828064989e-01f, 6.856585970e-01f, 6.885037051e-01f,
+	6.913417162e-01f, 6.941725233e-01f, 6.969960200e-01f, 6.998120999e-01f, 7.026206570e-01f, 7.054215855e-01f, 7.082147800e-01f, 7.110001354e-01f,
+	7.137775467e-01f, 7.165469094e-01f, 7.193081193e-01f, 7.220610723e-01f, 7.248056648e-01f, 7.275417936e-01f, 7.302693555e-01f, 7.329882479e-01f,
+	7.356983684e-01f, 7.383996150e-01f, 7.410918860e-01f, 7.437750801e-01f, 7.464490961e-01f, 7.491138335e-01f, 7.517691919e-01f, 7.544150713e-01f,
+	7.570513721e-01f, 7.596779951e-01f, 7.622948413e-01f, 7.649018123e-01f, 7.674988099e-01f, 7.700857364e-01f, 7.726624942e-01f, 7.752289865e-01f,
+	7.777851165e-01f, 7.803307881e-01f, 7.828659054e-01f, 7.853903729e-01f, 7.879040957e-01f, 7.904069790e-01f, 7.928989287e-01f, 7.953798509e-01f,
+	7.978496522e-01f, 8.003082397e-01f, 8.027555207e-01f, 8.051914031e-01f, 8.076157953e-01f, 8.100286059e-01f, 8.124297441e-01f, 8.148191195e-01f,
+	8.171966421e-01f, 8.195622224e-01f, 8.219157714e-01f, 8.242572005e-01f, 8.265864215e-01f, 8.289033466e-01f, 8.312078888e-01f, 8.334999612e-01f,
+	8.357794774e-01f, 8.380463518e-01f, 8.403004989e-01f, 8.425418339e-01f, 8.447702724e-01f, 8.469857304e-01f, 8.491881247e-01f, 8.513773722e-01f,
+	8.535533906e-01f, 8.557160979e-01f, 8.578654126e-01f, 8.600012540e-01f, 8.621235415e-01f, 8.642321952e-01f, 8.663271358e-01f, 8.684082844e-01f,
+	8.704755627e-01f, 8.725288927e-01f, 8.745681973e-01f, 8.765933995e-01f, 8.786044233e-01f, 8.806011927e-01f, 8.825836328e-01f, 8.845516688e-01f,
+	8.865052267e-01f, 8.884442328e-01f, 8.903686143e-01f, 8.922782986e-01f, 8.941732138e-01f, 8.960532887e-01f, 8.979184523e-01f, 8.997686346e-01f,
+	9.016037657e-01f, 9.034237768e-01f, 9.052285991e-01f, 9.070181649e-01f, 9.087924066e-01f, 9.105512575e-01f, 9.122946514e-01f, 9.140225226e-01f,
+	9.157348062e-01f, 9.174314375e-01f, 9.191123528e-01f, 9.207774887e-01f, 9.224267826e-01f, 9.240601724e-01f, 9.256775966e-01f, 9.272789942e-01f,
+	9.288643050e-01f, 9.304334693e-01f, 9.319864281e-01f, 9.335231228e-01f, 9.350434956e-01f, 9.365474892e-01f, 9.380350471e-01f, 9.395061132e-01f,
+	9.409606322e-01f, 9.423985492e-01f, 9.438198102e-01f, 9.452243616e-01f, 9.466121506e-01f, 9.479831249e-01f, 9.493372328e-01f, 9.506744235e-01f,
+	9.519946466e-01f, 9.532978523e-01f, 9.545839915e-01f, 9.558530160e-01f, 9.571048779e-01f, 9.583395300e-01f, 9.595569258e-01f, 9.607570197e-01f,
+	9.619397663e-01f, 9.631051211e-01f, 9.642530402e-01f, 9.653834805e-01f, 9.664963994e-01f, 9.675917550e-01f, 9.686695060e-01f, 9.697296118e-01f,
+	9.707720326e-01f, 9.717967291e-01f, 9.728036627e-01f, 9.737927955e-01f, 9.747640903e-01f, 9.757175105e-01f, 9.766530202e-01f, 9.775705842e-01f,
+	9.784701679e-01f, 9.793517374e-01f, 9.802152597e-01f, 9.810607021e-01f, 9.818880329e-01f, 9.826972208e-01f, 9.834882355e-01f, 9.842610471e-01f,
+	9.850156266e-01f, 9.857519455e-01f, 9.864699761e-01f, 9.871696914e-01f, 9.878510650e-01f, 9.885140713e-01f, 9.891586854e-01f, 9.897848828e-01f,
+	9.903926402e-01f, 9.909819346e-01f, 9.915527437e-01f, 9.921050462e-01f, 9.926388212e-01f, 9.931540486e-01f, 9.936507091e-01f, 9.941287839e-01f,
+	9.945882550e-01f, 9.950291051e-01f, 9.954513177e-01f, 9.958548768e-01f, 9.962397673e-01f, 9.966059746e-01f, 9.969534850e-01f, 9.972822854e-01f,
+	9.975923633e-01f, 9.978837072e-01f, 9.981563061e-01f, 9.984101496e-01f, 9.986452283e-01f, 9.988615333e-01f, 9.990590565e-01f, 9.992377903e-01f,
+	9.993977281e-01f, 9.995388639e-01f, 9.996611923e-01f, 9.997647088e-01f, 9.998494093e-01f, 9.999152909e-01f, 9.999623509e-01f, 9.999905876e-01f,
+	1.000000000e+00f, 9.999905876e-01f, 9.999623509e-01f, 9.999152909e-01f, 9.998494093e-01f, 9.997647088e-01f, 9.996611923e-01f, 9.995388639e-01f,
+	9.993977281e-01f, 9.992377903e-01f, 9.990590565e-01f, 9.988615333e-01f, 9.986452283e-01f, 9.984101496e-01f, 9.981563061e-01f, 9.978837072e-01f,
+	9.975923633e-01f, 9.972822854e-01f, 9.969534850e-01f, 9.966059746e-01f, 9.962397673e-01f, 9.958548768e-01f, 9.954513177e-01f, 9.950291051e-01f,
+	9.945882550e-01f, 9.941287839e-01f, 9.936507091e-01f, 9.931540486e-01f, 9.926388212e-01f, 9.921050462e-01f, 9.915527437e-01f, 9.909819346e-01f,
+	9.903926402e-01f, 9.897848828e-01f, 9.891586854e-01f, 9.885140713e-01f, 9.878510650e-01f, 9.871696914e-01f, 9.864699761e-01f, 9.857519455e-01f,
+	9.850156266e-01f, 9.842610471e-01f, 9.834882355e-01f, 9.826972208e-01f, 9.818880329e-01f, 9.810607021e-01f, 9.802152597e-01f, 9.793517374e-01f,
+	9.784701679e-01f, 9.775705842e-01f, 9.766530202e-01f, 9.757175105e-01f, 9.747640903e-01f, 9.737927955e-01f, 9.728036627e-01f, 9.717967291e-01f,
+	9.707720326e-01f, 9.697296118e-01f, 9.686695060e-01f, 9.675917550e-01f, 9.664963994e-01f, 9.653834805e-01f, 9.642530402e-01f, 9.631051211e-01f,
+	9.619397663e-01f, 9.607570197e-01f, 9.595569258e-01f, 9.583395300e-01f, 9.571048779e-01f, 9.558530160e-01f, 9.545839915e-01f, 9.532978523e-01f,
+	9.519946466e-01f, 9.506744235e-01f, 9.493372328e-01f, 9.479831249e-01f, 9.466121506e-01f, 9.452243616e-01f, 9.438198102e-01f, 9.423985492e-01f,
+	9.409606322e-01f, 9.395061132e-01f, 9.380350471e-01f, 9.365474892e-01f, 9.350434956e-01f, 9.335231228e-01f, 9.319864281e-01f, 9.304334693e-01f,
+	9.288643050e-01f, 9.272789942e-01f, 9.256775966e-01f, 9.240601724e-01f, 9.224267826e-01f, 9.207774887e-01f, 9.191123528e-01f, 9.174314375e-01f,
+	9.157348062e-01f, 9.140225226e-01f, 9.122946514e-01f, 9.105512575e-01f, 9.087924066e-01f, 9.070181649e-01f, 9.052285991e-01f, 9.034237768e-01f,
+	9.016037657e-01f, 8.997686346e-01f, 8.979184523e-01f, 8.960532887e-01f, 8.941732138e-01f, 8.922782986e-01f, 8.903686143e-01f, 8.884442328e-01f,
+	8.865052267e-01f, 8.845516688e-01f, 8.825836328e-01f, 8.806011927e-01f, 8.786044233e-01f, 8.765933995e-01f, 8.745681973e-01f, 8.725288927e-01f,
+	8.704755627e-01f, 8.684082844e-01f, 8.663271358e-01f, 8.642321952e-01f, 8.621235415e-01f, 8.600012540e-01f, 8.578654126e-01f, 8.557160979e-01f,
+	8.535533906e-01f, 8.513773722e-01f, 8.491881247e-01f, 8.469857304e-01f, 8.447702724e-01f, 8.425418339e-01f, 8.403004989e-01f, 8.380463518e-01f,
+	8.357794774e-01f, 8.334999612e-01f, 8.312078888e-01f, 8.289033466e-01f, 8.265864215e-01f, 8.242572005e-01f, 8.219157714e-01f, 8.195622224e-01f,
+	8.171966421e-01f, 8.148191195e-01f, 8.124297441e-01f, 8.100286059e-01f, 8.076157953e-01f, 8.051914031e-01f, 8.027555207e-01f, 8.003082397e-01f,
+	7.978496522e-01f, 7.953798509e-01f, 7.928989287e-01f, 7.904069790e-01f, 7.879040957e-01f, 7.853903729e-01f, 7.828659054e-01f, 7.803307881e-01f,
+	7.777851165e-01f, 7.752289865e-01f, 7.726624942e-01f, 7.700857364e-01f, 7.674988099e-01f, 7.649018123e-01f, 7.622948413e-01f, 7.596779951e-01f,
+	7.570513721e-01f, 7.544150713e-01f, 7.517691919e-01f, 7.491138335e-01f, 7.464490961e-01f, 7.437750801e-01f, 7.410918860e-01f, 7.383996150e-01f,
+	7.356983684e-01f, 7.329882479e-01f, 7.302693555e-01f, 7.275417936e-01f, 7.248056648e-01f, 7.220610723e-01f, 7.193081193e-01f, 7.165469094e-01f,
+	7.137775467e-01f, 7.110001354e-01f, 7.082147800e-01f, 7.054215855e-01f, 7.026206570e-01f, 6.998120999e-01f, 6.969960200e-01f, 6.941725233e-01f,
+	6.913417162e-01f, 6.885037051e-01f, 6.856585970e-01f, 6.828064989e-01f, 6.799475183e-01f, 6.770817627e-01f, 6.742093401e-01f, 6.713303587e-01f,
+	6.684449267e-01f, 6.655531529e-01f, 6.626551461e-01f, 6.597510154e-01f, 6.568408702e-01f, 6.539248200e-01f, 6.510029747e-01f, 6.480754441e-01f,
+	6.451423386e-01f, 6.422037686e-01f, 6.392598447e-01f, 6.363106777e-01f, 6.333563787e-01f, 6.303970590e-01f, 6.274328298e-01f, 6.244638029e-01f,
+	6.214900900e-01f, 6.185118030e-01f, 6.155290541e-01f, 6.125419557e-01f, 6.095506201e-01f, 6.065551600e-01f, 6.035556881e-01f, 6.005523174e-01f,
+	5.975451610e-01f, 5.945343321e-01f, 5.915199440e-01f, 5.885021102e-01f, 5.854809444e-01f, 5.824565602e-01f, 5.794290717e-01f, 5.763985926e-01f,
+	5.733652372e-01f, 5.703291197e-01f, 5.672903543e-01f, 5.642490554e-01f, 5.612053376e-01f, 5.581593155e-01f, 5.551111036e-01f, 5.520608169e-01f,
+	5.490085702e-01f, 5.459544782e-01f, 5.428986562e-01f, 5.398412190e-01f, 5.367822818e-01f, 5.337219598e-01f, 5.306603682e-01f, 5.275976222e-01f,
+	5.245338372e-01f, 5.214691285e-01f, 5.184036115e-01f, 5.153374016e-01f, 5.122706143e-01f, 5.092033650e-01f, 5.061357691e-01f, 5.030679423e-01f,
+	5.000000000e-01f, 4.969320577e-01f, 4.938642309e-01f, 4.907966350e-01f, 4.877293857e-01f, 4.846625984e-01f, 4.815963885e-01f, 4.785308715e-01f,
+	4.754661628e-01f, 4.724023778e-01f, 4.693396318e-01f, 4.662780402e-01f, 4.632177182e-01f, 4.601587810e-01f, 4.571013438e-01f, 4.540455218e-01f,
+	4.509914298e-01f, 4.479391831e-01f, 4.448888964e-01f, 4.418406845e-01f, 4.387946624e-01f, 4.357509446e-01f, 4.327096457e-01f, 4.296708803e-01f,
+	4.266347628e-01f, 4.236014074e-01f, 4.205709283e-01f, 4.175434398e-01f, 4.145190556e-01f, 4.114978898e-01f, 4.084800560e-01f, 4.054656679e-01f,
+	4.024548390e-01f, 3.994476826e-01f, 3.964443119e-01f, 3.934448400e-01f, 3.904493799e-01f, 3.874580443e-01f, 3.844709459e-01f, 3.814881970e-01f,
+	3.785099100e-01f, 3.755361971e-01f, 3.725671702e-01f, 3.696029410e-01f, 3.666436213e-01f, 3.636893223e-01f, 3.607401553e-01f, 3.577962314e-01f,
+	3.548576614e-01f, 3.519245559e-01f, 3.489970253e-01f, 3.460751800e-01f, 3.431591298e-01f, 3.402489846e-01f, 3.373448539e-01f, 3.344468471e-01f,
+	3.315550733e-01f, 3.286696413e-01f, 3.257906599e-01f, 3.229182373e-01f, 3.200524817e-01f, 3.171935011e-01f, 3.143414030e-01f, 3.114962949e-01f,
+	3.086582838e-01f, 3.058274767e-01f, 3.030039800e-01f, 3.001879001e-01f, 2.973793430e-01f, 2.945784145e-01f, 2.917852200e-01f, 2.889998646e-01f,
+	2.862224533e-01f, 2.834530906e-01f, 2.806918807e-01f, 2.779389277e-01f, 2.751943352e-01f, 2.724582064e-01f, 2.697306445e-01f, 2.670117521e-01f,
+	2.643016316e-01f, 2.616003850e-01f, 2.589081140e-01f, 2.562249199e-01f, 2.535509039e-01f, 2.508861665e-01f, 2.482308081e-01f, 2.455849287e-01f,
+	2.429486279e-01f, 2.403220049e-01f, 2.377051587e-01f, 2.350981877e-01f, 2.325011901e-01f, 2.299142636e-01f, 2.273375058e-01f, 2.247710135e-01f,
+	2.222148835e-01f, 2.196692119e-01f, 2.171340946e-01f, 2.146096271e-01f, 2.120959043e-01f, 2.095930210e-01f, 2.071010713e-01f, 2.046201491e-01f,
+	2.021503478e-01f, 1.996917603e-01f, 1.972444793e-01f, 1.948085969e-01f, 1.923842047e-01f, 1.899713941e-01f, 1.875702559e-01f, 1.851808805e-01f,
+	1.828033579e-01f, 1.804377776e-01f, 1.780842286e-01f, 1.757427995e-01f, 1.734135785e-01f, 1.710966534e-01f, 1.687921112e-01f, 1.665000388e-01f,
+	1.642205226e-01f, 1.619536482e-01f, 1.596995011e-01f, 1.574581661e-01f, 1.552297276e-01f, 1.530142696e-01f, 1.508118753e-01f, 1.486226278e-01f,
+	1.464466094e-01f, 1.442839021e-01f, 1.421345874e-01f, 1.399987460e-01f, 1.378764585e-01f, 1.357678048e-01f, 1.336728642e-01f, 1.315917156e-01f,
+	1.295244373e-01f, 1.274711073e-01f, 1.254318027e-01f, 1.234066005e-01f, 1.213955767e-01f, 1.193988073e-01f, 1.174163672e-01f, 1.154483312e-01f,
+	1.134947733e-01f, 1.115557672e-01f, 1.096313857e-01f, 1.077217014e-01f, 1.058267862e-01f, 1.039467113e-01f, 1.020815477e-01f, 1.002313654e-01f,
+	9.839623426e-02f, 9.657622323e-02f, 9.477140087e-02f, 9.298183515e-02f, 9.120759342e-02f, 8.944874250e-02f, 8.770534861e-02f, 8.597747737e-02f,
+	8.426519385e-02f, 8.256856251e-02f, 8.088764722e-02f, 7.922251128e-02f, 7.757321738e-02f, 7.593982760e-02f, 7.432240345e-02f, 7.272100582e-02f,
+	7.113569500e-02f, 6.956653068e-02f, 6.801357194e-02f, 6.647687724e-02f, 6.495650445e-02f, 6.345251079e-02f, 6.196495290e-02f, 6.049388679e-02f,
+	5.903936783e-02f, 5.760145078e-02f, 5.618018980e-02f, 5.477563838e-02f, 5.338784940e-02f, 5.201687512e-02f, 5.066276715e-02f, 4.932557648e-02f,
+	4.800535344e-02f, 4.670214774e-02f, 4.541600845e-02f, 4.414698400e-02f, 4.289512215e-02f, 4.166047004e-02f, 4.044307415e-02f, 3.924298033e-02f,
+	3.806023374e-02f, 3.689487893e-02f, 3.574695976e-02f, 3.461651946e-02f, 3.350360058e-02f, 3.240824503e-02f, 3.133049404e-02f, 3.027038820e-02f,
+	2.922796741e-02f, 2.820327092e-02f, 2.719633731e-02f, 2.620720449e-02f, 2.523590970e-02f, 2.428248952e-02f, 2.334697982e-02f, 2.242941585e-02f,
+	2.152983213e-02f, 2.064826255e-02f, 1.978474029e-02f, 1.893929787e-02f, 1.811196710e-02f, 1.730277915e-02f, 1.651176448e-02f, 1.573895286e-02f,
+	1.498437340e-02f, 1.424805451e-02f, 1.353002390e-02f, 1.283030861e-02f, 1.214893498e-02f, 1.148592867e-02f, 1.084131464e-02f, 1.021511716e-02f,
+	9.607359798e-03f, 9.018065445e-03f, 8.447256284e-03f, 7.894953807e-03f, 7.361178806e-03f, 6.845951378e-03f, 6.349290921e-03f, 5.871216135e-03f,
+	5.411745018e-03f, 4.970894869e-03f, 4.548682286e-03f, 4.145123165e-03f, 3.760232701e-03f, 3.394025383e-03f, 3.046514999e-03f, 2.717714633e-03f,
+	2.407636664e-03f, 2.116292766e-03f, 1.843693909e-03f, 1.589850354e-03f, 1.354771661e-03f, 1.138466678e-03f, 9.409435499e-04f, 7.622097134e-04f,
+	6.022718974e-04f, 4.611361237e-04f, 3.388077058e-04f, 2.352912495e-04f, 1.505906519e-04f, 8.470910209e-05f, 3.764908043e-05f, 9.412358699e-06f
+};
+
+const q15_t hann_window_q15[WINDOW_LENGTH] = {
+	0, 0, 1, 3, 5, 8, 11, 15, 20, 25, 31, 37,
+	44, 52, 60, 69, 79, 89, 100, 111, 123, 136, 149, 163,
+	177, 192, 208, 224, 241, 259, 277, 296, 315, 335, 355, 376,
+	398, 420, 443, 467, 491, 516, 541, 567, 593, 621, 648, 677,
+	705, 735, 765, 796, 827, 859, 891, 924, 958, 992, 1027, 1062,
+	1098, 1134, 1171, 1209, 1247, 1286, 1325, 1365, 1406, 1447, 1488, 1530,
+	1573, 1616, 1660, 1704, 1749, 1795, 1841, 1887, 1935, 1982, 2030, 2079,
+	2128, 2178, 2229, 2280, 2331, 2383, 2435, 2488, 2542, 2596, 2651, 2706,
+	2761, 2817, 2874, 2931, 2989, 3047, 3105, 3165, 3224, 3284, 3345, 3406,
+	3468, 3530, 3592, 3655, 3719, 3783, 3847, 3912, 3978, 4044, 4110, 4177,
+	4244, 4312, 4380, 4449, 4518, 4587, 4657, 4728, 4799, 4870, 4942, 5014,
+	5087, 5160, 5233, 5307, 5381, 5456, 5531, 5606, 5682, 5759, 5835, 5913,
+	5990, 6068, 6146, 6225, 6304, 6383, 6463, 6543, 6624, 6705, 6786, 6868,
+	6950, 7032, 7115, 7198, 7282, 7365, 7449, 7534, 7619, 7704, 7789, 7875,
+	7961, 8047, 8134, 8221, 8308, 8396, 8484, 8572, 8661, 8749, 8839, 8928,
+	9018, 9108, 9198, 9288, 9379, 9470, 9561, 9653, 9745, 9837, 9929, 10021,
+	10114, 10207, 10300, 10394, 10487, 10581, 10676, 10770, 10864, 10959, 11054, 11149,
+	11245, 11340, 11436, 11532, 11628, 11724, 11821, 11917, 12014, 12111, 12208, 12306,
+	12403, 12501, 12598, 12696, 12794, 12892, 12991, 13089, 13188, 13286, 13385, 13484,
+	13583, 13682, 13781, 13881, 13980, 14079, 14179, 14279, 14378, 14478, 14578, 14678,
+	14778, 14878, 14978, 15078, 15179, 15279, 15379, 15480, 15580, 15680, 15781, 15881,
+	15982, 16082, 16183, 16283, 16384, 16485, 16585, 16686, 16786, 16887, 16987, 17088,
+	17188, 17288, 17389, 17489, 17589, 17690, 17790, 17890, 17990, 18090, 18190, 18290,
+	18390, 18489, 18589, 18689, 18788, 18887, 18987, 19086, 19185, 19284, 19383, 19482,
+	19580, 19679, 19777, 19876, 19974, 20072, 20170, 20267, 20365, 20462, 20560, 20657,
+	20754, 20851, 20947, 21044, 21140, 21236, 21332, 21428, 21523, 21619, 21714, 21809,
+	21904, 21998, 22092, 22187, 22281, 22374, 22468, 22561, 22654, 22747, 22839, 22931,
+	23023, 23115, 23207, 23298, 23389, 23480, 23570, 23660, 23750, 23840, 23929, 24019,
+	24107, 24196, 24284, 24372, 24460, 24547, 24634, 24721, 24807, 24893, 24979, 25064,
+	25149, 25234, 25319, 25403, 25486, 25570, 25653, 25736, 25818, 25900, 25982, 26063,
+	26144, 26225, 26305, 26385, 26464, 26543, 26622, 26700, 26778, 26855, 26933, 27009,
+	27086, 27162, 27237, 27312, 27387, 27461, 27535, 27608, 27681, 27754, 27826, 27898,
+	27969, 28040, 28111, 28181, 28250, 28319, 28388, 28456, 28524, 28591, 28658, 28724,
+	28790, 28856, 28921, 28985, 29049, 29113, 29176, 29238, 29300, 29362, 29423, 29484,
+	29544, 29603, 29663, 29721, 29779, 29837, 29894, 29951, 30007, 30062, 30117, 30172,
+	30226, 30280, 30333, 30385, 30437, 30488, 30539, 30590, 30640, 30689, 30738, 30786,
+	30833, 30881, 30927, 30973, 31019, 31064, 31108, 31152, 31195, 31238, 31280, 31321,
+	31362, 31403, 31443, 31482, 31521, 31559, 31597, 31634, 31670, 31706, 31741, 31776,
+	31810, 31844, 31877, 31909, 31941, 31972, 32003, 32033, 32063, 32091, 32120, 32147,
+	32175, 32201, 32227, 32252, 32277, 32301, 32325, 32348, 32370, 32392, 32413, 32433,
+	32453, 32472, 32491, 32509, 32527, 32544, 32560, 32576, 32591, 32605, 32619, 32632,
+	32645, 32657, 32668, 32679, 32689, 32699, 32708, 32716, 32724, 32731, 32737, 32743,
+	32748, 32753, 32757, 32760, 32763, 32765, 32767, 32767, 32767, 32767, 32767, 32765,
+	32763, 32760, 32757, 32753, 32748, 32743, 32737, 32731, 32724, 32716, 32708, 32699,
+	32689, 32679, 32668, 32657, 32645, 32632, 32619, 32605, 32591, 32576, 32560, 32544,
+	32527, 32509, 32491, 32472, 32453, 32433, 32413, 32392, 32370, 32348, 32325, 32301,
+	32277, 32252, 32227, 32201, 32175, 32147, 32120, 32091, 32063, 32033, 32003, 31972,
+	31941, 31909, 31877, 31844, 31810, 31776, 31741, 31706, 31670, 31634, 31597, 31559,
+	31521, 31482, 31443, 31403, 31362, 31321, 31280, 31238, 31195, 31152, 31108, 31064,
+	31019, 30973, 30927, 30881, 30833, 30786, 30738, 30689, 30640, 30590, 30539, 30488,
+	30437, 30385, 30333, 30280, 30226, 30172, 30117, 30062, 30007, 29951, 29894, 29837,
+	29779, 29721, 29663, 29603, 29544, 29484, 29423, 29362, 29300, 29238, 29176, 29113,
+	29049, 28985, 28921, 28856, 28790, 28724, 28658, 28591, 28524, 28456, 28388, 28319,
+	28250, 28181, 28111, 28040, 27969, 27898, 27826, 27754, 27681, 27608, 27535, 27461,
+	27387, 27312, 27237, 27162, 27086, 27009, 26933, 26855, 26778, 26700, 26622, 26543,
+	26464, 26385, 26305, 26225, 26144, 26063, 25982, 25900, 25818, 25736, 25653, 25570,
+	25486, 25403, 25319, 25234, 25149, 25064, 24979, 24893, 24807, 24721, 24634, 24547,
+	24460, 24372, 24284, 24196, 24107, 24019, 23929, 23840, 23750, 23660, 23570, 23480,
+	23389, 23298, 23207, 23115, 23023, 22931, 22839, 22747, 22654, 22561, 22468, 22374,
+	22281, 22187, 22092, 21998, 21904, 21809, 21714, 21619, 21523, 21428, 21332, 21236,
+	21140, 21044, 20947, 20851, 20754, 20657, 20560, 20462, 20365, 20267, 20170, 20072,
+	19974, 19876, 19777, 19679, 19580, 19482, 19383, 19284, 19185, 19086, 18987, 18887,
+	18788, 18689, 18589, 18489, 18390, 18290, 18190, 18090, 17990, 17890, 17790, 17690,
+	17589, 17489, 17389, 17288, 17188, 17088, 16987, 16887, 16786, 16686, 16585, 16485,
+	16384, 16283, 16183, 16082, 15982, 15881, 15781, 15680, 15580, 15480, 15379, 15279,
+	15179, 15078, 14978, 14878, 14778, 14678, 14578, 14478, 14378, 14279, 14179, 14079,
+	13980, 13881, 13781, 13682, 13583, 13484, 13385, 13286, 13188, 13089, 12991, 12892,
+	12794, 12696, 12598, 12501, 12403, 12306, 12208, 12111, 12014, 11917, 11821, 11724,
+	11628, 11532, 11436, 11340, 11245, 11149, 11054, 10959, 10864, 10770, 10676, 10581,
+	10487, 10394, 10300, 10207, 10114, 10021, 9929, 9837, 9745, 9653, 9561, 9470,
+	9379, 9288, 9198, 9108, 9018, 8928, 8839, 8749, 8661, 8572, 8484, 8396,
+	8308, 8221, 8134, 8047, 7961, 7875, 7789, 7704, 7619, 7534, 7449, 7365,
+	7282, 7198, 7115, 7032, 6950, 6868, 6786, 6705, 6624, 6543, 6463, 6383,
+	6304, 6225, 6146, 6068, 5990, 5913, 5835, 5759, 5682, 5606, 5531, 5456,
+	5381, 5307, 5233, 5160, 5087, 5014, 4942, 4870, 4799, 4728, 4657, 4587,
+	4518, 4449, 4380, 4312, 4244, 4177, 4110, 4044, 3978, 3912, 3847, 3783,
+	3719, 3655, 3592, 3530, 3468, 3406, 3345, 3284, 3224, 3165, 3105, 3047,
+	2989, 2931, 2874, 2817, 2761, 2706, 2651, 2596, 2542, 2488, 2435, 2383,
+	2331, 2280, 2229, 2178, 2128, 2079, 2030, 1982, 1935, 1887, 1841, 1795,
+	1749, 1704, 1660, 1616, 1573, 1530, 1488, 1447, 1406, 1365, 1325, 1286,
+	1247, 1209, 1171, 1134, 1098, 1062, 1027, 992, 958, 924, 891, 859,
+	827, 796, 765, 735, 705, 677, 648, 621, 593, 567, 541, 516,
+	491, 467, 443, 420, 398, 376, 355, 335, 315, 296, 277, 259,
+	241, 224, 208, 192, 177, 163, 149, 136, 123, 111, 100, 89,
+	79, 69, 60, 52, 44, 37, 31, 25, 20, 15, 11, 8,
+	5, 3, 1, 0
+};
+
+const float32_t dct2_basis_f32[N_MFCC_COEFFS * N_MEL_BANDS] = {
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f, 1.767766953e-01f,
+	1.767234535e-01f, 1.762977112e-01f, 1.754472523e-01f, 1.741741256e-01f, 1.724813981e-01f, 1.703731479e-01f, 1.678544539e-01f, 1.649313837e-01f,
+	1.616109794e-01f, 1.579012401e-01f, 1.538111029e-01f, 1.493504213e-01f, 1.445299414e-01f, 1.393612762e-01f, 1.338568775e-01f, 1.280300059e-01f,
+	1.218946988e-01f, 1.154657366e-01f, 1.087586074e-01f, 1.017894692e-01f, 9.457511124e-02f, 8.713291354e-02f, 7.948080502e-02f, 7.163722029e-02f,
+	6.362105521e-02f, 5.545162144e-02f, 4.714859986e-02f, 3.873199317e-02f, 3.022207772e-02f, 2.163935463e-02f, 1.300450044e-02f, 4.338317277e-03f,
+	-4.338317277e-03f, -1.300450044e-02f, -2.163935463e-02f, -3.022207772e-02f, -3.873199317e-02f, -4.714859986e-02f, -5.545162144e-02f, -6.362105521e-02f,
+	-7.163722029e-02f, -7.948080502e-02f, -8.713291354e-02f, -9.457511124e-02f, -1.017894692e-01f, -1.087586074e-01f, -1.154657366e-01f, -1.218946988e-01f,
+	-1.280300059e-01f, -1.338568775e-01f, -1.393612762e-01f, -1.445299414e-01f, -1.493504213e-01f, -1.538111029e-01f, -1.579012401e-01f, -1.616109794e-01f,
+	-1.649313837e-01f, -1.678544539e-01f, -1.703731479e-01f, -1.724813981e-01f, -1.741741256e-01f, -1.754472523e-01f, -1.762977112e-01f, -1.767234535e-01f,
+	1.765637600e-01f, 1.748633545e-01f, 1.714789193e-01f, 1.664430483e-01f, 1.598042398e-01f, 1.516264291e-01f, 1.419883731e-01f, 1.309828913e-01f,
+	1.187159727e-01f, 1.053057544e-01f, 9.088138416e-02f, 7.558177647e-02f, 5.955427496e-02f, 4.295323323e-02f, 2.593852837e-02f, 8.674021313e-03f,
+	-8.674021313e-03f, -2.593852837e-02f, -4.295323323e-02f, -5.955427496e-02f, -7.558177647e-02f, -9.088138416e-02f, -1.053057544e-01f, -1.187159727e-01f,
+	-1.309828913e-01f, -1.419883731e-01f, -1.516264291e-01f, -1.598042398e-01f, -1.664430483e-01f, -1.714789193e-01f, -1.748633545e-01f, -1.765637600e-01f,
+	-1.765637600e-01f, -1.748633545e-01f, -1.714789193e-01f, -1.664430483e-01f, -1.598042398e-01f, -1.516264291e-01f, -1.419883731e-01f, -1.309828913e-01f,
+	-1.187159727e-01f, -1.053057544e-01f, -9.088138416e-02f, -7.558177647e-02f, -5.955427496e-02f, -4.295323323e-02f, -2.593852837e-02f, -8.674021313e-03f,
+	8.674021313e-03f, 2.593852837e-02f, 4.295323323e-02f, 5.955427496e-02f, 7.558177647e-02f, 9.088138416e-02f, 1.053057544e-01f, 1.187159727e-01f,
+	1.309828913e-01f, 1.419883731e-01f, 1.516264291e-01f, 1.598042398e-01f, 1.664430483e-01f, 1.714789193e-01f, 1.748633545e-01f, 1.765637600e-01f,
+	1.762977112e-01f, 1.724813981e-01f, 1.649313837e-01f, 1.538111029e-01f, 1.393612762e-01f, 1.218946988e-01f, 1.017894692e-01f, 7.948080502e-02f,
+	5.545162144e-02f, 3.022207772e-02f, 4.338317277e-03f, -2.163935463e-02f, -4.714859986e-02f, -7.163722029e-02f, -9.457511124e-02f, -1.154657366e-01f,
+	-1.338568775e-01f, -1.493504213e-01f, -1.616109794e-01f, -1.703731479e-01f, -1.754472523e-01f, -1.767234535e-01f, -1.741741256e-01f, -1.678544539e-01f,
+	-1.579012401e-01f, -1.445299414e-01f, -1.280300059e-01f, -1.087586074e-01f, -8.713291354e-02f, -6.362105521e-02f, -3.873199317e-02f, -1.300450044e-02f,
+	1.300450044e-02f, 3.873199317e-02f, 6.362105521e-02f, 8.713291354e-02f, 1.087586074e-01f, 1.280300059e-01f, 1.445299414e-01f, 1.579012401e-01f,
+	1.678544539e-01f, 1.741741256e-01f, 1.767234535e-01f, 1.754472523e-01f, 1.703731479e-01f, 1.616109794e-01f, 1.493504213e-01f, 1.338568775e-01f,
+	1.154657366e-01f, 9.457511124e-02f, 7.163722029e-02f, 4.714859986e-02f, 2.163935463e-02f, -4.338317277e-03f, -3.022207772e-02f, -5.545162144e-02f,
+	-7.948080502e-02f, -1.017894692e-01f, -1.218946988e-01f, -1.393612762e-01f, -1.538111029e-01f, -1.649313837e-01f, -1.724813981e-01f, -1.762977112e-01f,
+	1.759254672e-01f, 1.691647501e-01f, 1.559031266e-01f, 1.366502334e-01f, 1.121459483e-01f, 8.333195731e-02f, 5.131556594e-02f, 1.732714615e-02f,
+	-1.732714615e-02f, -5.131556594e-02f, -8.333195731e-02f, -1.121459483e-01f, -1.366502334e-01f, -1.559031266e-01f, -1.691647501e-01f, -1.759254672e-01f,
+	-1.759254672e-01f, -1.691647501e-01f, -1.559031266e-01f, -1.366502334e-01f, -1.121459483e-01f, -8.333195731e-02f, -5.131556594e-02f, -1.732714615e-02f,
+	1.732714615e-02f, 5.131556594e-02f, 8.333195731e-02f, 1.121459483e-01f, 1.366502334e-01f, 1.559031266e-01f, 1.691647501e-01f, 1.759254672e-01f,
+	1.759254672e-01f, 1.691647501e-01f, 1.559031266e-01f, 1.366502334e-01f, 1.121459483e-01f, 8.333195731e-02f, 5.131556594e-02f, 1.732714615e-02f,
+	-1.732714615e-02f, -5.131556594e-02f, -8.333195731e-02f, -1.121459483e-01f, -1.366502334e-01f, -1.559031266e-01f, -1.691647501e-01f, -1.759254672e-01f,
+	-1.759254672e-01f, -1.691647501e-01f, -1.559031266e-01f, -1.366502334e-01f, -1.121459483e-01f, -8.333195731e-02f, -5.131556594e-02f, -1.732714615e-02f,
+	1.732714615e-02f, 5.131556594e-02f, 8.333195731e-02f, 1.121459483e-01f, 1.366502334e-01f, 1.559031266e-01f, 1.691647501e-01f, 1.759254672e-01f,
+	1.754472523e-01f, 1.649313837e-01f, 1.445299414e-01f, 1.154657366e-01f, 7.948080502e-02f, 3.873199317e-02f, -4.338317277e-03f, -4.714859986e-02f,
+	-8.713291354e-02f, -1.218946988e-01f, -1.493504213e-01f, -1.678544539e-01f, -1.762977112e-01f, -1.741741256e-01f, -1.616109794e-01f, -1.393612762e-01f,
+	-1.087586074e-01f, -7.163722029e-02f, -3.022207772e-02f, 1.300450044e-02f, 5.545162144e-02f, 9.457511124e-02f, 1.280300059e-01f, 1.538111029e-01f,
+	1.703731479e-01f, 1.767234535e-01f, 1.724813981e-01f, 1.579012401e-01f, 1.338568775e-01f, 1.017894692e-01f, 6.362105521e-02f, 2.163935463e-02f,
+	-2.163935463e-02f, -6.362105521e-02f, -1.017894692e-01f, -1.338568775e-01f, -1.579012401e-01f, -1.724813981e-01f, -1.767234535e-01f, -1.703731479e-01f,
+	-1.538111029e-01f, -1.280300059e-01f, -9.457511124e-02f, -5.545162144e-02f, -1.300450044e-02f, 3.022207772e-02f, 7.163722029e-02f, 1.087586074e-01f,
+	1.393612762e-01f, 1.616109794e-01f, 1.741741256e-01f, 1.762977112e-01f, 1.678544539e-01f, 1.493504213e-01f, 1.218946988e-01f, 8.713291354e-02f,
+	4.714859986e-02f, 4.338317277e-03f, -3.873199317e-02f, -7.948080502e-02f, -1.154657366e-01f, -1.445299414e-01f, -1.649313837e-01f, -1.754472523e-01f,
+	1.748633545e-01f, 1.598042398e-01f, 1.309828913e-01f, 9.088138416e-02f, 4.295323323e-02f, -8.674021313e-03f, -5.955427496e-02f, -1.053057544e-01f,
+	-1.419883731e-01f, -1.664430483e-01f, -1.765637600e-01f, -1.714789193e-01f, -1.516264291e-01f, -1.187159727e-01f, -7.558177647e-02f, -2.593852837e-02f,
+	2.593852837e-02f, 7.558177647e-02f, 1.187159727e-01f, 1.516264291e-01f, 1.714789193e-01f, 1.765637600e-01f, 1.664430483e-01f, 1.419883731e-01f,
+	1.053057544e-01f, 5.955427496e-02f, 8.674021313e-03f, -4.295323323e-02f, -9.088138416e-02f, -1.309828913e-01f, -1.598042398e-01f, -1.748633545e-01f,
+	-1.748633545e-01f, -1.598042398e-01f, -1.309828913e-01f, -9.088138416e-02f, -4.295323323e-02f, 8.674021313e-03f, 5.955427496e-02f, 1.053057544e-01f,
+	1.419883731e-01f, 1.664430483e-01f, 1.765637600e-01f, 1.714789193e-01f, 1.516264291e-01f, 1.187159727e-01f, 7.558177647e-02f, 2.593852837e-02f,
+	-2.593852837e-02f, -7.558177647e-02f, -1.187159727e-01f, -1.516264291e-01f, -1.714789193e-01f, -1.765637600e-01f, -1.664430483e-01f, -1.419883731e-01f,
+	-1.053057544e-01f, -5.955427496e-02f, -8.674021313e-03f, 4.295323323e-02f, 9.088138416e-02f, 1.309828913e-01f, 1.598042398e-01f, 1.748633545e-01f,
+	1.741741256e-01f, 1.538111029e-01f, 1.154657366e-01f, 6.362105521e-02f, 4.338317277e-03f, -5.545162144e-02f, -1.087586074e-01f, -1.493504213e-01f,
+	-1.724813981e-01f, -1.754472523e-01f, -1.579012401e-01f, -1.218946988e-01f, -7.163722029e-02f, -1.300450044e-02f, 4.714859986e-02f, 1.017894692e-01f,
+	1.445299414e-01f, 1.703731479e-01f, 1.762977112e-01f, 1.616109794e-01f, 1.280300059e-01f, 7.948080502e-02f, 2.163935463e-02f, -3.873199317e-02f,
+	-9.457511124e-02f, -1.393612762e-01f, -1.678544539e-01f, -1.767234535e-01f, -1.649313837e-01f, -1.338568775e-01f, -8.713291354e-02f, -3.022207772e-02f,
+	3.022207772e-02f, 8.713291354e-02f, 1.338568775e-01f, 1.649313837e-01f, 1.767234535e-01f, 1.678544539e-01f, 1.393612762e-01f, 9.457511124e-02f,
+	3.873199317e-02f, -2.163935463e-02f, -7.948080502e-02f, -1.280300059e-01f, -1.616109794e-01f, -1.762977112e-01f, -1.703731479e-01f, -1.445299414e-01f,
+	-1.017894692e-01f, -4.714859986e-02f, 1.300450044e-02f, 7.163722029e-02f, 1.218946988e-01f, 1.579012401e-01f, 1.754472523e-01f, 1.724813981e-01f,
+	1.493504213e-01f, 1.087586074e-01f, 5.545162144e-02f, -4.338317277e-03f, -6.362105521e-02f, -1.154657366e-01f, -1.538111029e-01f, -1.741741256e-01f,
+	1.733799807e-01f, 1.469844503e-01f, 9.821186980e-02f, 3.448742241e-02f, -3.448742241e-02f, -9.821186980e-02f, -1.469844503e-01f, -1.733799807e-01f,
+	-1.733799807e-01f, -1.469844503e-01f, -9.821186980e-02f, -3.448742241e-02f, 3.448742241e-02f, 9.821186980e-02f, 1.469844503e-01f, 1.733799807e-01f,
+	1.733799807e-01f, 1.469844503e-01f, 9.821186980e-02f, 3.448742241e-02f, -3.448742241e-02f, -9.821186980e-02f, -1.469844503e-01f, -1.733799807e-01f,
+	-1.733799807e-01f, -1.469844503e-01f, -9.821186980e-02f, -3.448742241e-02f, 3.448742241e-02f, 9.821186980e-02f, 1.469844503e-01f, 1.733799807e-01f,
+	1.733799807e-01f, 1.469844503e-01f, 9.821186980e-02f, 3.448742241e-02f, -3.448742241e-02f, -9.821186980e-02f, -1.469844503e-01f, -1.733799807e-01f,
+	-1.733799807e-01f, -1.469844503e-01f, -9.821186980e-02f, -3.448742241e-02f, 3.448742241e-02f, 9.821186980e-02f, 1.469844503e-01f, 1.733799807e-01f,
+	1.733799807e-01f, 1.469844503e-01f, 9.821186980e-02f, 3.448742241e-02f, -3.448742241e-02f, -9.821186980e-02f, -1.469844503e-01f, -1.733799807e-01f,
+	-1.733799807e-01f, -1.469844503e-01f, -9.821186980e-02f, -3.448742241e-02f, 3.448742241e-02f, 9.821186980e-02f, 1.469844503e-01f, 1.733799807e-01f,
+	1.724813981e-01f, 1.393612762e-01f, 7.948080502e-02f, 4.338317277e-03f, -7.163722029e-02f, -1.338568775e-01f, -1.703731479e-01f, -1.741741256e-01f,
+	-1.445299414e-01f, -8.713291354e-02f, -1.300450044e-02f, 6.362105521e-02f, 1.280300059e-01f, 1.678544539e-01f, 1.754472523e-01f, 1.493504213e-01f,
+	9.457511124e-02f, 2.163935463e-02f, -5.545162144e-02f, -1.218946988e-01f, -1.649313837e-01f, -1.762977112e-01f, -1.538111029e-01f, -1.017894692e-01f,
+	-3.022207772e-02f, 4.714859986e-02f, 1.154657366e-01f, 1.616109794e-01f, 1.767234535e-01f, 1.579012401e-01f, 1.087586074e-01f, 3.873199317e-02f,
+	-3.873199317e-02f, -1.087586074e-01f, -1.579012401e-01f, -1.767234535e-01f, -1.616109794e-01f, -1.154657366e-01f, -4.714859986e-02f, 3.022207772e-02f,
+	1.017894692e-01f, 1.538111029e-01f, 1.762977112e-01f, 1.649313837e-01f, 1.218946988e-01f, 5.545162144e-02f, -2.163935463e-02f, -9.457511124e-02f,
+	-1.493504213e-01f, -1.754472523e-01f, -1.678544539e-01f, -1.280300059e-01f, -6.362105521e-02f, 1.300450044e-02f, 8.713291354e-02f, 1.445299414e-01f,
+	1.741741256e-01f, 1.703731479e-01f, 1.338568775e-01f, 7.163722029e-02f, -4.338317277e-03f, -7.948080502e-02f, -1.393612762e-01f, -1.724813981e-01f,
+	1.714789193e-01f, 1.309828913e-01f, 5.955427496e-02f, -2.593852837e-02f, -1.053057544e-01f, -1.598042398e-01f, -1.765637600e-01f, -1.516264291e-01f,
+	-9.088138416e-02f, -8.674021313e-03f, 7.558177647e-02f, 1.419883731e-01f, 1.748633545e-01f, 1.664430483e-01f, 1.187159727e-01f, 4.295323323e-02f,
+	-4.295323323e-02f, -1.187159727e-01f, -1.664430483e-01f, -1.748633545e-01f, -1.419883731e-01f, -7.558177647e-02f, 8.674021313e-03f, 9.088138416e-02f,
+	1.516264291e-01f, 1.765637600e-01f, 1.598042398e-01f, 1.053057544e-01f, 2.593852837e-02f, -5.955427496e-02f, -1.309828913e-01f, -1.714789193e-01f,
+	-1.714789193e-01f, -1.309828913e-01f, -5.955427496e-02f, 2.593852837e-02f, 1.053057544e-01f, 1.598042398e-01f, 1.765637600e-01f, 1.516264291e-01f,
+	9.088138416e-02f, 8.674021313e-03f, -7.558177647e-02f, -1.419883731e-01f, -1.748633545e-01f, -1.664430483e-01f, -1.187159727e-01f, -4.295323323e-02f,
+	4.295323323e-02f, 1.187159727e-01f, 1.664430483e-01f, 1.748633545e-01f, 1.419883731e-01f, 7.558177647e-02f, -8.674021313e-03f, -9.088138416e-02f,
+	-1.516264291e-01f, -1.765637600e-01f, -1.598042398e-01f, -1.053057544e-01f, -2.593852837e-02f, 5.955427496e-02f, 1.309828913e-01f, 1.714789193e-01f,
+	1.703731479e-01f, 1.218946988e-01f, 3.873199317e-02f, -5.545162144e-02f, -1.338568775e-01f, -1.741741256e-01f, -1.649313837e-01f, -1.087586074e-01f,
+	-2.163935463e-02f, 7.163722029e-02f, 1.445299414e-01f, 1.762977112e-01f, 1.579012401e-01f, 9.457511124e-02f, 4.338317277e-03f, -8.713291354e-02f,
+	-1.538111029e-01f, -1.767234535e-01f, -1.493504213e-01f, -7.948080502e-02f, 1.300450044e-02f, 1.017894692e-01f, 1.616109794e-01f, 1.754472523e-01f,
+	1.393612762e-01f, 6.362105521e-02f, -3.022207772e-02f, -1.154657366e-01f, -1.678544539e-01f, -1.724813981e-01f, -1.280300059e-01f, -4.714859986e-02f,
+	4.714859986e-02f, 1.280300059e-01f, 1.724813981e-01f, 1.678544539e-01f, 1.154657366e-01f, 3.022207772e-02f, -6.362105521e-02f, -1.393612762e-01f,
+	-1.754472523e-01f, -1.616109794e-01f, -1.017894692e-01f, -1.300450044e-02f, 7.948080502e-02f, 1.493504213e-01f, 1.767234535e-01f, 1.538111029e-01f,
+	8.713291354e-02f, -4.338317277e-03f, -9.457511124e-02f, -1.579012401e-01f, -1.762977112e-01f, -1.445299414e-01f, -7.163722029e-02f, 2.163935463e-02f,
+	1.087586074e-01f, 1.649313837e-01f, 1.741741256e-01f, 1.338568775e-01f, 5.545162144e-02f, -3.873199317e-02f, -1.218946988e-01f, -1.703731479e-01f,
+	1.691647501e-01f, 1.121459483e-01f, 1.732714615e-02f, -8.333195731e-02f, -1.559031266e-01f, -1.759254672e-01f, -1.366502334e-01f, -5.131556594e-02f,
+	5.131556594e-02f, 1.366502334e-01f, 1.759254672e-01f, 1.559031266e-01f, 8.333195731e-02f, -1.732714615e-02f, -1.121459483e-01f, -1.691647501e-01f,
+	-1.691647501e-01f, -1.121459483e-01f, -1.732714615e-02f, 8.333195731e-02f, 1.559031266e-01f, 1.759254672e-01f, 1.366502334e-01f, 5.131556594e-02f,
+	-5.131556594e-02f, -1.366502334e-01f, -1.759254672e-01f, -1.559031266e-01f, -8.333195731e-02f, 1.732714615e-02f, 1.121459483e-01f, 1.691647501e-01f,
+	1.691647501e-01f, 1.121459483e-01f, 1.732714615e-02f, -8.333195731e-02f, -1.559031266e-01f, -1.759254672e-01f, -1.366502334e-01f, -5.131556594e-02f,
+	5.131556594e-02f, 1.366502334e-01f, 1.759254672e-01f, 1.559031266e-01f, 8.333195731e-02f, -1.732714615e-02f, -1.121459483e-01f, -1.691647501e-01f,
+	-1.691647501e-01f, -1.121459483e-01f, -1.732714615e-02f, 8.333195731e-02f, 1.559031266e-01f, 1.759254672e-01f, 1.366502334e-01f, 5.131556594e-02f,
+	-5.131556594e-02f, -1.366502334e-01f, -1.759254672e-01f, -1.559031266e-01f, -8.333195731e-02f, 1.732714615e-02f, 1.121459483e-01f, 1.691647501e-01f
+};
+
+const float32_t dct2_basis_int8_f32[N_MFCC_COEFFS * N_MEL_BANDS] = {
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f, 1.101032316e-01f,
+	1.100700705e-01f, 1.098049021e-01f, 1.092752040e-01f, 1.084822524e-01f, 1.074279576e-01f, 1.061148594e-01f, 1.045461212e-01f, 1.027255222e-01f,
+	1.006574484e-01f, 9.834688208e-02f, 9.579938947e-02f, 9.302110774e-02f, 9.001873001e-02f, 8.679948928e-02f, 8.337114097e-02f, 7.974194429e-02f,
+	7.592064228e-02f, 7.191644078e-02f, 6.773898629e-02f, 6.339834264e-02f, 5.890496683e-02f, 5.426968380e-02f, 4.950366035e-02f, 4.461837824e-02f,
+	3.962560655e-02f, 3.453737330e-02f, 2.936593650e-02f, 2.412375458e-02f, 1.882345643e-02f, 1.347781092e-02f, 8.099696181e-03f, 2.702068567e-03f,
+	-2.702068567e-03f, -8.099696181e-03f, -1.347781092e-02f, -1.882345643e-02f, -2.412375458e-02f, -2.936593650e-02f, -3.453737330e-02f, -3.962560655e-02f,
+	-4.461837824e-02f, -4.950366035e-02f, -5.426968380e-02f, -5.890496683e-02f, -6.339834264e-02f, -6.773898629e-02f, -7.191644078e-02f, -7.592064228e-02f,
+	-7.974194429e-02f, -8.337114097e-02f, -8.679948928e-02f, -9.001873001e-02f, -9.302110774e-02f, -9.579938947e-02f, -9.834688208e-02f, -1.006574484e-01f,
+	-1.027255222e-01f, -1.045461212e-01f, -1.061148594e-01f, -1.074279576e-01f, -1.084822524e-01f, -1.092752040e-01f, -1.098049021e-01f, -1.100700705e-01f,
+	1.099706074e-01f, 1.089115303e-01f, 1.068035757e-01f, 1.036670442e-01f, 9.953214248e-02f, 9.443869177e-02f, 8.843574484e-02f, 8.158111334e-02f,
+	7.394081112e-02f, 6.558841847e-02f, 5.660437350e-02f, 4.707519746e-02f, 3.709266154e-02f, 2.675290302e-02f, 1.615549941e-02f, 5.402509509e-03f,
+	-5.402509509e-03f, -1.615549941e-02f, -2.675290302e-02f, -3.709266154e-02f, -4.707519746e-02f, -5.660437350e-02f, -6.558841847e-02f, -7.394081112e-02f,
+	-8.158111334e-02f, -8.843574484e-02f, -9.443869177e-02f, -9.953214248e-02f, -1.036670442e-01f, -1.068035757e-01f, -1.089115303e-01f, -1.099706074e-01f,
+	-1.099706074e-01f, -1.089115303e-01f, -1.068035757e-01f, -1.036670442e-01f, -9.953214248e-02f, -9.443869177e-02f, -8.843574484e-02f, -8.158111334e-02f,
+	-7.394081112e-02f, -6.558841847e-02f, -5.660437350e-02f, -4.707519746e-02f, -3.709266154e-02f, -2.675290302e-02f, -1.615549941e-02f, -5.402509509e-03f,
+	5.402509509e-03f, 1.615549941e-02f, 2.675290302e-02f, 3.709266154e-02f, 4.707519746e-02f, 5.660437350e-02f, 6.558841847e-02f, 7.394081112e-02f,
+	8.158111334e-02f, 8.843574484e-02f, 9.443869177e-02f, 9.953214248e-02f, 1.036670442e-01f, 1.068035757e-01f, 1.089115303e-01f, 1.099706074e-01f,
+	1.098049021e-01f, 1.074279576e-01f, 1.027255222e-01f, 9.579938947e-02f, 8.679948928e-02f, 7.592064228e-02f, 6.339834264e-02f, 4.950366035e-02f,
+	3.453737330e-02f, 1.882345643e-02f, 2.702068567e-03f, -1.347781092e-02f, -2.936593650e-02f, -4.461837824e-02f, -5.890496683e-02f, -7.191644078e-02f,
+	-8.337114097e-02f, -9.302110774e-02f, -1.006574484e-01f, -1.061148594e-01f, -1.092752040e-01f, -1.100700705e-01f, -1.084822524e-01f, -1.045461212e-01f,
+	-9.834688208e-02f, -9.001873001e-02f, -7.974194429e-02f, -6.773898629e-02f, -5.426968380e-02f, -3.962560655e-02f, -2.412375458e-02f, -8.099696181e-03f,
+	8.099696181e-03f, 2.412375458e-02f, 3.962560655e-02f, 5.426968380e-02f, 6.773898629e-02f, 7.974194429e-02f, 9.001873001e-02f, 9.834688208e-02f,
+	1.045461212e-01f, 1.084822524e-01f, 1.100700705e-01f, 1.092752040e-01f, 1.061148594e-01f, 1.006574484e-01f, 9.302110774e-02f, 8.337114097e-02f,
+	7.191644078e-02f, 5.890496683e-02f, 4.461837824e-02f, 2.936593650e-02f, 1.347781092e-02f, -2.702068567e-03f, -1.882345643e-02f, -3.453737330e-02f,
+	-4.950366035e-02f, -6.339834264e-02f, -7.592064228e-02f, -8.679948928e-02f, -9.579938947e-02f, -1.027255222e-01f, -1.074279576e-01f, -1.098049021e-01f,
+	1.095730544e-01f, 1.053622234e-01f, 9.710238120e-02f, 8.511094895e-02f, 6.984875067e-02f, 5.190230408e-02f, 3.196128104e-02f, 1.079200390e-02f,
+	-1.079200390e-02f, -3.196128104e-02f, -5.190230408e-02f, -6.984875067e-02f, -8.511094895e-02f, -9.710238120e-02f, -1.053622234e-01f, -1.095730544e-01f,
+	-1.095730544e-01f, -1.053622234e-01f, -9.710238120e-02f, -8.511094895e-02f, -6.984875067e-02f, -5.190230408e-02f, -3.196128104e-02f, -1.079200390e-02f,
+	1.079200390e-02f, 3.196128104e-02f, 5.190230408e-02f, 6.984875067e-02f, 8.511094895e-02f, 9.710238120e-02f, 1.053622234e-01f, 1.095730544e-01f,
+	1.095730544e-01f, 1.053622234e-01f, 9.710238120e-02f, 8.511094895e-02f, 6.984875067e-02f, 5.190230408e-02f, 3.196128104e-02f, 1.079200390e-02f,
+	-1.079200390e-02f, -3.196128104e-02f, -5.190230408e-02f, -6.984875067e-02f, -8.511094895e-02f, -9.710238120e-02f, -1.053622234e-01f, -1.095730544e-01f,
+	-1.095730544e-01f, -1.053622234e-01f, -9.710238120e-02f, -8.511094895e-02f, -6.984875067e-02f, -5.190230408e-02f, -3.196128104e-02f, -1.079200390e-02f,
+	1.079200390e-02f, 3.196128104e-02f, 5.190230408e-02f, 6.984875067e-02f, 8.511094895e-02f, 9.710238120e-02f, 1.053622234e-01f, 1.095730544e-01f,
+	1.092752040e-01f, 1.027255222e-01f, 9.001873001e-02f, 7.191644078e-02f, 4.950366035e-02f, 2.412375458e-02f, -2.702068567e-03f, -2.936593650e-02f,
+	-5.426968380e-02f, -7.592064228e-02f, -9.302110774e-02f, -1.045461212e-01f, -1.098049021e-01f, -1.084822524e-01f, -1.006574484e-01f, -8.679948928e-02f,
+	-6.773898629e-02f, -4.461837824e-02f, -1.882345643e-02f, 8.099696181e-03f, 3.453737330e-02f, 5.890496683e-02f, 7.974194429e-02f, 9.579938947e-02f,
+	1.061148594e-01f, 1.100700705e-01f, 1.074279576e-01f, 9.834688208e-02f, 8.337114097e-02f, 6.339834264e-02f, 3.962560655e-02f, 1.347781092e-02f,
+	-1.347781092e-02f, -3.962560655e-02f, -6.339834264e-02f, -8.337114097e-02f, -9.834688208e-02f, -1.074279576e-01f, -1.100700705e-01f, -1.061148594e-01f,
+	-9.579938947e-02f, -7.974194429e-02f, -5.890496683e-02f, -3.453737330e-02f, -8.099696181e-03f, 1.882345643e-02f, 4.461837824e-02f, 6.773898629e-02f,
+	8.679948928e-02f, 1.006574484e-01f, 1.084822524e-01f, 1.098049021e-01f, 1.045461212e-01f, 9.302110774e-02f, 7.592064228e-02f, 5.426968380e-02f,
+	2.936593650e-02f, 2.702068567e-03f, -2.412375458e-02f, -4.950366035e-02f, -7.191644078e-02f, -9.001873001e-02f, -1.027255222e-01f, -1.092752040e-01f,
+	1.089115303e-01f, 9.953214248e-02f, 8.158111334e-02f, 5.660437350e-02f, 2.675290302e-02f, -5.402509509e-03f, -3.709266154e-02f, -6.558841847e-02f,
+	-8.843574484e-02f, -1.036670442e-01f, -1.099706074e-01f, -1.068035757e-01f, -9.443869177e-02f, -7.394081112e-02f, -4.707519746e-02f, -1.615549941e-02f,
+	1.615549941e-02f, 4.707519746e-02f, 7.394081112e-02f, 9.443869177e-02f, 1.068035757e-01f, 1.099706074e-01f, 1.036670442e-01f, 8.843574484e-02f,
+	6.558841847e-02f, 3.709266154e-02f, 5.402509509e-03f, -2.675290302e-02f, -5.660437350e-02f, -8.158111334e-02f, -9.953214248e-02f, -1.089115303e-01f,
+	-1.089115303e-01f, -9.953214248e-02f, -8.158111334e-02f, -5.660437350e-02f, -2.675290302e-02f, 5.402509509e-03f, 3.709266154e-02f, 6.558841847e-02f,
+	8.843574484e-02f, 1.036670442e-01f, 1.099706074e-01f, 1.068035757e-01f, 9.443869177e-02f, 7.394081112e-02f, 4.707519746e-02f, 1.615549941e-02f,
+	-1.615549941e-02f, -4.707519746e-02f, -7.394081112e-02f, -9.443869177e-02f, -1.068035757e-01f, -1.099706074e-01f, -1.036670442e-01f, -8.843574484e-02f,
+	-6.558841847e-02f, -3.709266154e-02f, -5.402509509e-03f, 2.675290302e-02f, 5.660437350e-02f, 8.158111334e-02f, 9.953214248e-02f, 1.089115303e-01f,
+	1.084822524e-01f, 9.579938947e-02f, 7.191644078e-02f, 3.962560655e-02f, 2.702068567e-03f, -3.453737330e-02f, -6.773898629e-02f, -9.302110774e-02f,
+	-1.074279576e-01f, -1.092752040e-01f, -9.834688208e-02f, -7.592064228e-02f, -4.461837824e-02f, -8.099696181e-03f, 2.936593650e-02f, 6.339834264e-02f,
+	9.001873001e-02f, 1.061148594e-01f, 1.098049021e-01f, 1.006574484e-01f, 7.974194429e-02f, 4.950366035e-02f, 1.347781092e-02f, -2.412375458e-02f,
+	-5.890496683e-02f, -8.679948928e-02f, -1.045461212e-01f, -1.100700705e-01f, -1.027255222e-01f, -8.337114097e-02f, -5.426968380e-02f, -1.882345643e-02f,
+	1.882345643e-02f, 5.426968380e-02f, 8.337114097e-02f, 1.027255222e-01f, 1.100700705e-01f, 1.045461212e-01f, 8.679948928e-02f, 5.890496683e-02f,
+	2.412375458e-02f, -1.347781092e-02f, -4.950366035e-02f, -7.974194429e-02f, -1.006574484e-01f, -1.098049021e-01f, -1.061148594e-01f, -9.001873001e-02f,
+	-6.339834264e-02f, -2.936593650e-02f, 8.099696181e-03f, 4.461837824e-02f, 7.592064228e-02f, 9.834688208e-02f, 1.092752040e-01f, 1.074279576e-01f,
+	9.302110774e-02f, 6.773898629e-02f, 3.453737330e-02f, -2.702068567e-03f, -3.962560655e-02f, -7.191644078e-02f, -9.579938947e-02f, -1.084822524e-01f,
+	1.079876288e-01f, 9.154749127e-02f, 6.117007802e-02f, 2.148007490e-02f, -2.148007490e-02f, -6.117007802e-02f, -9.154749127e-02f, -1.079876288e-01f,
+	-1.079876288e-01f, -9.154749127e-02f, -6.117007802e-02f, -2.148007490e-02f, 2.148007490e-02f, 6.117007802e-02f, 9.154749127e-02f, 1.079876288e-01f,
+	1.079876288e-01f, 9.154749127e-02f, 6.117007802e-02f, 2.148007490e-02f, -2.148007490e-02f, -6.117007802e-02f, -9.154749127e-02f, -1.079876288e-01f,
+	-1.079876288e-01f, -9.154749127e-02f, -6.117007802e-02f, -2.148007490e-02f, 2.148007490e-02f, 6.117007802e-02f, 9.154749127e-02f, 1.079876288e-01f,
+	1.079876288e-01f, 9.154749127e-02f, 6.117007802e-02f, 2.148007490e-02f, -2.148007490e-02f, -6.117007802e-02f, -9.154749127e-02f, -1.079876288e-01f,
+	-1.079876288e-01f, -9.154749127e-02f, -6.117007802e-02f, -2.148007490e-02f, 2.148007490e-02f, 6.117007802e-02f, 9.154749127e-02f, 1.079876288e-01f,
+	1.079876288e-01f, 9.154749127e-02f, 6.117007802e-02f, 2.148007490e-02f, -2.148007490e-02f, -6.117007802e-02f, -9.154749127e-02f, -1.079876288e-01f,
+	-1.079876288e-01f, -9.154749127e-02f, -6.117007802e-02f, -2.148007490e-02f, 2.148007490e-02f, 6.117007802e-02f, 9.154749127e-02f, 1.079876288e-01f,
+	1.074279576e-01f, 8.679948928e-02f, 4.950366035e-02f, 2.702068567e-03f, -4.461837824e-02f, -8.337114097e-02f, -1.061148594e-01f, -1.084822524e-01f,
+	-9.001873001e-02f, -5.426968380e-02f, -8.099696181e-03f, 3.962560655e-02f, 7.974194429e-02f, 1.045461212e-01f, 1.092752040e-01f, 9.302110774e-02f,
+	5.890496683e-02f, 1.347781092e-02f, -3.453737330e-02f, -7.592064228e-02f, -1.027255222e-01f, -1.098049021e-01f, -9.579938947e-02f, -6.339834264e-02f,
+	-1.882345643e-02f, 2.936593650e-02f, 7.191644078e-02f, 1.006574484e-01f, 1.100700705e-01f, 9.834688208e-02f, 6.773898629e-02f, 2.412375458e-02f,
+	-2.412375458e-02f, -6.773898629e-02f, -9.834688208e-02f, -1.100700705e-01f, -1.006574484e-01f, -7.191644078e-02f, -2.936593650e-02f, 1.882345643e-02f,
+	6.339834264e-02f, 9.579938947e-02f, 1.098049021e-01f, 1.027255222e-01f, 7.592064228e-02f, 3.453737330e-02f, -1.347781092e-02f, -5.890496683e-02f,
+	-9.302110774e-02f, -1.092752040e-01f, -1.045461212e-01f, -7.974194429e-02f, -3.962560655e-02f, 8.099696181e-03f, 5.426968380e-02f, 9.001873001e-02f,
+	1.084822524e-01f, 1.061148594e-01f, 8.337114097e-02f, 4.461837824e-02f, -2.702068567e-03f, -4.950366035e-02f, -8.679948928e-02f, -1.074279576e-01f,
+	1.068035757e-01f, 8.158111334e-02f, 3.709266154e-02f, -1.615549941e-02f, -6.558841847e-02f, -9.953214248e-02f, -1.099706074e-01f, -9.443869177e-02f,
+	-5.660437350e-02f, -5.402509509e-03f, 4.707519746e-02f, 8.843574484e-02f, 1.089115303e-01f, 1.036670442e-01f, 7.394081112e-02f, 2.675290302e-02f,
+	-2.675290302e-02f, -7.394081112e-02f, -1.036670442e-01f, -1.089115303e-01f, -8.843574484e-02f, -4.707519746e-02f, 5.402509509e-03f, 5.660437350e-02f,
+	9.443869177e-02f, 1.099706074e-01f, 9.953214248e-02f, 6.558841847e-02f, 1.615549941e-02f, -3.709266154e-02f, -8.158111334e-02f, -1.068035757e-01f,
+	-1.068035757e-01f, -8.158111334e-02f, -3.709266154e-02f, 1.615549941e-02f, 6.558841847e-02f, 9.953214248e-02f, 1.099706074e-01f, 9.443869177e-02f,
+	5.660437350e-02f, 5.402509509e-03f, -4.707519746e-02f, -8.843574484e-02f, -1.089115303e-01f, -1.036670442e-01f, -7.394081112e-02f, -2.675290302e-02f,
+	2.675290302e-02f, 7.394081112e-02f, 1.036670442e-01f, 1.089115303e-01f, 8.843574484e-02f, 4.707519746e-02f, -5.402509509e-03f, -5.660437350e-02f,
+	-9.443869177e-02f, -1.099706074e-01f, -9.953214248e-02f, -6.558841847e-02f, -1.615549941e-02f, 3.709266154e-02f, 8.158111334e-02f, 1.068035757e-01f,
+	1.061148594e-01f, 7.592064228e-02f, 2.412375458e-02f, -3.453737330e-02f, -8.337114097e-02f, -1.084822524e-01f, -1.027255222e-01f, -6.773898629e-02f,
+	-1.347781092e-02f, 4.461837824e-02f, 9.001873001e-02f, 1.098049021e-01f, 9.834688208e-02f, 5.890496683e-02f, 2.702068567e-03f, -5.426968380e-02f,
+	-9.579938947e-02f, -1.100700705e-01f, -9.302110774e-02f, -4.950366035e-02f, 8.099696181e-03f, 6.339834264e-02f, 1.006574484e-01f, 1.092752040e-01f,
+	8.679948928e-02f, 3.962560655e-02f, -1.882345643e-02f, -7.191644078e-02f, -1.045461212e-01f, -1.074279576e-01f, -7.974194429e-02f, -2.936593650e-02f,
+	2.936593650e-02f, 7.974194429e-02f, 1.074279576e-01f, 1.045461212e-01f, 7.191644078e-02f, 1.882345643e-02f, -3.962560655e-02f, -8.679948928e-02f,
+	-1.092752040e-01f, -1.006574484e-01f, -6.339834264e-02f, -8.099696181e-03f, 4.950366035e-02f, 9.302110774e-02f, 1.100700705e-01f, 9.579938947e-02f,
+	5.426968380e-02f, -2.702068567e-03f, -5.890496683e-02f, -9.834688208e-02f, -1.098049021e-01f, -9.001873001e-02f, -4.461837824e-02f, 1.347781092e-02f,
+	6.773898629e-02f, 1.027255222e-01f, 1.084822524e-01f, 8.337114097e-02f, 3.453737330e-02f, -2.412375458e-02f, -7.592064228e-02f, -1.061148594e-01f,
+	1.053622234e-01f, 6.984875067e-02f, 1.079200390e-02f, -5.190230408e-02f, -9.710238120e-02f, -1.095730544e-01f, -8.511094895e-02f, -3.196128104e-02f,
+	3.196128104e-02f, 8.511094895e-02f, 1.095730544e-01f, 9.710238120e-02f, 5.190230408e-02f, -1.079200390e-02f, -6.984875067e-02f, -1.053622234e-01f,
+	-1.053622234e-01f, -6.984875067e-02f, -1.079200390e-02f, 5.190230408e-02f, 9.710238120e-02f, 1.095730544e-01f, 8.511094895e-02f, 3.196128104e-02f,
+	-3.196128104e-02f, -8.511094895e-02f, -1.095730544e-01f, -9.710238120e-02f, -5.190230408e-02f, 1.079200390e-02f, 6.984875067e-02f, 1.053622234e-01f,
+	1.053622234e-01f, 6.984875067e-02f, 1.079200390e-02f, -5.190230408e-02f, -9.710238120e-02f, -1.095730544e-01f, -8.511094895e-02f, -3.196128104e-02f,
+	3.196128104e-02f, 8.511094895e-02f, 1.095730544e-01f, 9.710238120e-02f, 5.190230408e-02f, -1.079200390e-02f, -6.984875067e-02f, -1.053622234e-01f,
+	-1.053622234e-01f, -6.984875067e-02f, -1.079200390e-02f, 5.190230408e-02f, 9.710238120e-02f, 1.095730544e-01f, 8.511094895e-02f, 3.196128104e-02f,
+	-3.196128104e-02f, -8.511094895e-02f, -1.095730544e-01f, -9.710238120e-02f, -5.190230408e-02f, 1.079200390e-02f, 6.984875067e-02f, 1.053622234e-01f
+};
+
+const float32_t dct2_bias_int8_f32 = 3.144651095e+01f;
+
+const q31_t dct2_basis_log2_int8_q28[N_MFCC_COEFFS * N_MEL_BANDS] = {
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389, 20486389,
+	20480218, 20430880, 20332321, 20184781, 19988613, 19744291, 19452403, 19113653,
+	18728856, 18298940, 17824940, 17307998, 16749360, 16150371, 15512475, 14837207,
+	14126196, 13381153, 12603873, 11796230, 10960169, 10097704, 9210912, 8301931,
+	7372950, 6426206, 5463981, 4488593, 3502392, 2507753, 1507072, 502761,
+	-502761, -1507072, -2507753, -3502392, -4488593, -5463981, -6426206, -7372950,
+	-8301931, -9210912, -10097704, -10960169, -11796230, -12603873, -13381153, -14126196,
+	-14837207, -15512475, -16150371, -16749360, -17307998, -17824940, -18298940, -18728856,
+	-19113653, -19452403, -19744291, -19988613, -20184781, -20332321, -20430880, -20480218,
+	20461712, 20264654, 19872437, 19288838, 18519476, 17571762, 16454822, 15179413,
+	13757818, 12203727, 10532109, 8759060, 6901656, 4977786, 3005978, 1005219,
+	-1005219, -3005978, -4977786, -6901656, -8759060, -10532109, -12203727, -13757818,
+	-15179413, -16454822, -17571762, -18519476, -19288838, -19872437, -20264654, -20461712,
+	-20461712, -20264654, -19872437, -19288838, -18519476, -17571762, -16454822, -15179413,
+	-13757818, -12203727, -10532109, -8759060, -6901656, -4977786, -3005978, -1005219,
+	1005219, 3005978, 4977786, 6901656, 8759060, 10532109, 12203727, 13757818,
+	15179413, 16454822, 17571762, 18519476, 19288838, 19872437, 20264654, 20461712,
+	20430880, 19988613, 19113653, 17824940, 16150371, 14126196, 11796230, 9210912,
+	6426206, 3502392, 502761, -2507753, -5463981, -8301931, -10960169, -13381153,
+	-15512475, -17307998, -18728856, -19744291, -20332321, -20480218, -20184781, -19452403,
+	-18298940, -16749360, -14837207, -12603873, -10097704, -7372950, -4488593, -1507072,
+	1507072, 4488593, 7372950, 10097704, 12603873, 14837207, 16749360, 18298940,
+	19452403, 20184781, 20480218, 20332321, 19744291, 18728856, 17307998, 15512475,
+	13381153, 10960169, 8301931, 5463981, 2507753, -502761, -3502392, -6426206,
+	-9210912, -11796230, -14126196, -16150371, -17824940, -19113653, -19988613, -20430880,
+	20387741, 19604252, 18067382, 15836193, 12996427, 9657217, 5946885, 2008017,
+	-2008017, -5946885, -9657217, -12996427, -15836193, -18067382, -19604252, -20387741,
+	-20387741, -19604252, -18067382, -15836193, -12996427, -9657217, -5946885, -2008017,
+	2008017, 5946885, 9657217, 12996427, 15836193, 18067382, 19604252, 20387741,
+	20387741, 19604252, 18067382, 15836193, 12996427, 9657217, 5946885, 2008017,
+	-2008017, -5946885, -9657217, -12996427, -15836193, -18067382, -19604252, -20387741,
+	-20387741, -19604252, -18067382, -15836193, -12996427, -9657217, -5946885, -2008017,
+	2008017, 5946885, 9657217, 12996427, 15836193, 18067382, 19604252, 20387741,
+	20332321, 19113653, 16749360, 13381153, 9210912, 4488593, -502761, -5463981,
+	-10097704, -14126196, -17307998, -19452403, -20430880, -20184781, -18728856, -16150371,
+	-12603873, -8301931, -3502392, 1507072, 6426206, 10960169, 14837207, 17824940,
+	19744291, 20480218, 19988613, 18298940, 15512475, 11796230, 7372950, 2507753,
+	-2507753, -7372950, -11796230, -15512475, -18298940, -19988613, -20480218, -19744291,
+	-17824940, -14837207, -10960169, -6426206, -1507072, 3502392, 8301931, 12603873,
+	16150371, 18728856, 20184781, 20430880, 19452403, 17307998, 14126196, 10097704,
+	5463981, 502761, -4488593, -9210912, -13381153, -16749360, -19113653, -20332321,
+	20264654, 18519476, 15179413, 10532109, 4977786, -1005219, -6901656, -12203727,
+	-16454822, -19288838, -20461712, -19872437, -17571762, -13757818, -8759060, -3005978,
+	3005978, 8759060, 13757818, 17571762, 19872437, 20461712, 19288838, 16454822,
+	12203727, 6901656, 1005219, -4977786, -10532109, -15179413, -18519476, -20264654,
+	-20264654, -18519476, -15179413, -10532109, -4977786, 1005219, 6901656, 12203727,
+	16454822, 19288838, 20461712, 19872437, 17571762, 13757818, 8759060, 3005978,
+	-3005978, -8759060, -13757818, -17571762, -19872437, -20461712, -19288838, -16454822,
+	-12203727, -6901656, -1005219, 4977786, 10532109, 15179413, 18519476, 20264654,
+	20184781, 17824940, 13381153, 7372950, 502761, -6426206, -12603873, -17307998,
+	-19988613, -20332321, -18298940, -14126196, -8301931, -1507072, 5463981, 11796230,
+	16749360, 19744291, 20430880, 18728856, 14837207, 9210912, 2507753, -4488593,
+	-10960169, -16150371, -19452403, -20480218, -19113653, -15512475, -10097704, -3502392,
+	3502392, 10097704, 15512475, 19113653, 20480218, 19452403, 16150371, 10960169,
+	4488593, -2507753, -9210912, -14837207, -18728856, -20430880, -19744291, -16749360,
+	-11796230, -5463981, 1507072, 8301931, 14126196, 18298940, 20332321, 19988613,
+	17307998, 12603873, 6426206, -502761, -7372950, -13381153, -17824940, -20184781,
+	20092748, 17033810, 11381628, 3996696, -3996696, -11381628, -17033810, -20092748,
+	-20092748, -17033810, -11381628, -3996696, 3996696, 11381628, 17033810, 20092748,
+	20092748, 17033810, 11381628, 3996696, -3996696, -11381628, -17033810, -20092748,
+	-20092748, -17033810, -11381628, -3996696, 3996696, 11381628, 17033810, 20092748,
+	20092748, 17033810, 11381628, 3996696, -3996696, -11381628, -17033810, -20092748,
+	-20092748, -17033810, -11381628, -3996696, 3996696, 11381628, 17033810, 20092748,
+	20092748, 17033810, 11381628, 3996696, -3996696, -11381628, -17033810, -20092748,
+	-20092748, -17033810, -11381628, -3996696, 3996696, 11381628, 17033810, 20092748,
+	19988613, 16150371, 9210912, 502761, -8301931, -15512475, -19744291, -20184781,
+	-16749360, -10097704, -1507072, 7372950, 14837207, 19452403, 20332321, 17307998,
+	10960169, 2507753, -6426206, -14126196, -19113653, -20430880, -17824940, -11796230,
+	-3502392, 5463981, 13381153, 18728856, 20480218, 18298940, 12603873, 4488593,
+	-4488593, -12603873, -18298940, -20480218, -18728856, -13381153, -5463981, 3502392,
+	11796230, 17824940, 20430880, 19113653, 14126196, 6426206, -2507753, -10960169,
+	-17307998, -20332321, -19452403, -14837207, -7372950, 1507072, 10097704, 16749360,
+	20184781, 19744291, 15512475, 8301931, -502761, -9210912, -16150371, -19988613,
+	19872437, 15179413, 6901656, -3005978, -12203727, -18519476, -20461712, -17571762,
+	-10532109, -1005219, 8759060, 16454822, 20264654, 19288838, 13757818, 4977786,
+	-4977786, -13757818, -19288838, -20264654, -16454822, -8759060, 1005219, 10532109,
+	17571762, 20461712, 18519476, 12203727, 3005978, -6901656, -15179413, -19872437,
+	-19872437, -15179413, -6901656, 3005978, 12203727, 18519476, 20461712, 17571762,
+	10532109, 1005219, -8759060, -16454822, -20264654, -19288838, -13757818, -4977786,
+	4977786, 13757818, 19288838, 20264654, 16454822, 8759060, -1005219, -10532109,
+	-17571762, -20461712, -18519476, -12203727, -3005978, 6901656, 15179413, 19872437,
+	19744291, 14126196, 4488593, -6426206, -15512475, -20184781, -19113653, -12603873,
+	-2507753, 8301931, 16749360, 20430880, 18298940, 10960169, 502761, -10097704,
+	-17824940, -20480218, -17307998, -9210912, 1507072, 11796230, 18728856, 20332321,
+	16150371, 7372950, -3502392, -13381153, -19452403, -19988613, -14837207, -5463981,
+	5463981, 14837207, 19988613, 19452403, 13381153, 3502392, -7372950, -16150371,
+	-20332321, -18728856, -11796230, -1507072, 9210912, 17307998, 20480218, 17824940,
+	10097704, -502761, -10960169, -18298940, -20430880, -16749360, -8301931, 2507753,
+	12603873, 19113653, 20184781, 15512475, 6426206, -4488593, -14126196, -19744291,
+	19604252, 12996427, 2008017, -9657217, -18067382, -20387741, -15836193, -5946885,
+	5946885, 15836193, 20387741, 18067382, 9657217, -2008017, -12996427, -19604252,
+	-19604252, -12996427, -2008017, 9657217, 18067382, 20387741, 15836193, 5946885,
+	-5946885, -15836193, -20387741, -18067382, -9657217, 2008017, 12996427, 19604252,
+	19604252, 12996427, 2008017, -9657217, -18067382, -20387741, -15836193, -5946885,
+	5946885, 15836193, 20387741, 18067382, 9657217, -2008017, -12996427, -19604252,
+	-19604252, -12996427, -2008017, 9657217, 18067382, 20387741, 15836193, 5946885,
+	-5946885, -15836193, -20387741, -18067382, -9657217, 2008017, 12996427, 19604252
+};
+
+const int64_t dct2_bias_int8_q44 = 553212871074175LL;
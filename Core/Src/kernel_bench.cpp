@@ -0,0 +1,212 @@
+/*
+ * kernel_bench.cpp
+ *
+ *  Per-kernel microbenchmark, see kernel_bench.h
+ */
+
+#include "kernel_bench.h"
+#include <string.h>
+#include "timing_scope.h"
+#include "tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "tensorflow/lite/micro/compatibility.h"
+#include "tensorflow/lite/micro/kernels/kernel_runner.h"
+#include "tensorflow/lite/micro/memory_helpers.h"
+#include "tensorflow/lite/schema/schema_utils.h"
+
+// Hands out the memory of one operator, reset before the next one
+class BenchAllocator : public tflite::BuiltinDataAllocator {
+public:
+	BenchAllocator(uint8_t* memory, size_t size) : memory(memory), size(size), used(0) {}
+
+	void* Allocate(size_t bytes, size_t alignment_hint) override {
+		uint8_t* start = tflite::AlignPointerUp(memory + used, alignment_hint > 0 ? alignment_hint : 1);
+		if(start + bytes > memory + size){
+			return nullptr;
+		}
+		used = start + bytes - memory;
+		return start;
+	}
+	void Deallocate(void*) override {}
+
+	void reset(){
+		used = 0;
+	}
+
+private:
+	uint8_t* memory;
+	size_t size;
+	size_t used;
+	TF_LITE_REMOVE_VIRTUAL_DELETE
+};
+
+static TfLiteIntArray* int_array(BenchAllocator* allocator, int size){
+	TfLiteIntArray* array = (TfLiteIntArray*)allocator->Allocate(
+			TfLiteIntArrayGetSizeInBytes(size), alignof(TfLiteIntArray));
+	if(array != nullptr){
+		array->size = size;
+	}
+	return array;
+}
+
+// Fills a TfLiteTensor like MicroAllocator does for the interpreter, with the
+// buffers of activations in the operator's memory
+static TfLiteStatus create_tensor(const tflite::Model* model, const tflite::Tensor* flatbuffer_tensor,
+		BenchAllocator* allocator, tflite::ErrorReporter* error_reporter, TfLiteTensor* tensor){
+	memset(tensor, 0, sizeof(*tensor));
+	size_t bytes;
+	size_t type_size;
+	TF_LITE_ENSURE_STATUS(tflite::ConvertTensorType(flatbuffer_tensor->type(), &tensor->type, error_reporter));
+	TF_LITE_ENSURE_STATUS(tflite::BytesRequiredForTensor(*flatbuffer_tensor, &bytes, &type_size, error_reporter));
+	tensor->bytes = bytes;
+	tensor->is_variable = flatbuffer_tensor->is_variable();
+
+	const flatbuffers::Vector<int32_t>* shape = flatbuffer_tensor->shape();
+	int rank = shape != nullptr ? shape->size() : 0;
+	tensor->dims = int_array(allocator, rank);
+	if(tensor->dims == nullptr){
+		return kTfLiteError;
+	}
+	for(int i = 0; i < rank; i++){
+		tensor->dims->data[i] = shape->Get(i);
+	}
+
+	const tflite::Buffer* buffer = model->buffers()->Get(flatbuffer_tensor->buffer());
+	if(buffer != nullptr && buffer->data() != nullptr && buffer->data()->size() > 0){
+		tensor->data.data = const_cast<uint8_t*>(buffer->data()->data());
+		tensor->allocation_type = kTfLiteMmapRo;
+	} else {
+		tensor->data.data = allocator->Allocate(bytes, 16);
+		if(tensor->data.data == nullptr){
+			return kTfLiteError;
+		}
+		memset(tensor->data.data, 0, bytes);
+		tensor->allocation_type = kTfLiteArenaRw;
+	}
+
+	const tflite::QuantizationParameters* quantization = flatbuffer_tensor->quantization();
+	if(quantization != nullptr && quantization->scale() != nullptr && quantization->scale()->size() > 0 &&
+			quantization->zero_point() != nullptr && quantization->zero_point()->size() > 0){
+		int channels = quantization->scale()->size();
+		TfLiteAffineQuantization* affine = (TfLiteAffineQuantization*)allocator->Allocate(
+				sizeof(TfLiteAffineQuantization), alignof(TfLiteAffineQuantization));
+		TfLiteFloatArray* scale = (TfLiteFloatArray*)allocator->Allocate(
+				TfLiteFloatArrayGetSizeInBytes(channels), alignof(TfLiteFloatArray));
+		TfLiteIntArray* zero_point = int_array(allocator, channels);
+		if(affine == nullptr || scale == nullptr || zero_point == nullptr){
+			return kTfLiteError;
+		}
+		scale->size = channels;
+		for(int i = 0; i < channels; i++){
+			scale->data[i] = quantization->scale()->Get(i);
+			zero_point->data[i] = quantization->zero_point()->Get(i);
+		}
+		affine->scale = scale;
+		affine->zero_point = zero_point;
+		affine->quantized_dimension = quantization->quantized_dimension();
+		tensor->params.scale = scale->data[0];
+		tensor->params.zero_point = zero_point->data[0];
+		tensor->quantization.type = kTfLiteAffineQuantization;
+		tensor->quantization.params = affine;
+	}
+	return kTfLiteOk;
+}
+
+// Sets up one operator and times rounds * KERNEL_BENCH_REPEATS Invoke()s
+static TfLiteStatus bench_operator(const tflite::Model* model, const tflite::Operator* op,
+		const tflite::MicroOpResolver& op_resolver, BenchAllocator* allocator, int rounds,
+		tflite::ErrorReporter* error_reporter, struct KernelBenchResult* result){
+	const tflite::OperatorCode* opcode = model->operator_codes()->Get(op->opcode_index());
+	tflite::BuiltinOperator builtin_code = tflite::GetBuiltinCode(opcode);
+	result->op = tflite::EnumNameBuiltinOperator(builtin_code);
+	const TfLiteRegistration* registration = op_resolver.FindOp(builtin_code);
+	tflite::MicroOpResolver::BuiltinParseFunction parser = op_resolver.GetOpDataParser(builtin_code);
+	if(registration == nullptr || parser == nullptr || builtin_code == tflite::BuiltinOperator_CUSTOM){
+		return kTfLiteError;
+	}
+
+	const flatbuffers::Vector<int32_t>* op_inputs = op->inputs();
+	const flatbuffers::Vector<int32_t>* op_outputs = op->outputs();
+	int n_inputs = op_inputs->size();
+	int n_outputs = op_outputs->size();
+	if(n_inputs + n_outputs > KERNEL_BENCH_MAX_TENSORS){
+		return kTfLiteError;
+	}
+
+	// The runner's tensors are the inputs followed by the outputs, optional
+	// inputs stay -1
+	TfLiteTensor tensors[KERNEL_BENCH_MAX_TENSORS];
+	TfLiteIntArray* inputs = int_array(allocator, n_inputs);
+	TfLiteIntArray* outputs = int_array(allocator, n_outputs);
+	if(inputs == nullptr || outputs == nullptr){
+		return kTfLiteError;
+	}
+	const flatbuffers::Vector<flatbuffers::Offset<tflite::Tensor>>* model_tensors =
+			model->subgraphs()->Get(0)->tensors();
+	int count = 0;
+	for(int i = 0; i < n_inputs + n_outputs; i++){
+		int index = i < n_inputs ? op_inputs->Get(i) : op_outputs->Get(i - n_inputs);
+		TfLiteIntArray* indices = i < n_inputs ? inputs : outputs;
+		int position = i < n_inputs ? i : i - n_inputs;
+		if(index < 0){
+			indices->data[position] = -1;
+			continue;
+		}
+		TF_LITE_ENSURE_STATUS(create_tensor(model, model_tensors->Get(index), allocator, error_reporter,
+				&tensors[count]));
+		indices->data[position] = count++;
+	}
+	result->input = (n_inputs > 0 && inputs->data[0] >= 0) ? tensors[inputs->data[0]].dims : nullptr;
+	result->output = (n_outputs > 0) ? tensors[outputs->data[0]].dims : nullptr;
+
+	void* builtin_data = nullptr;
+	TF_LITE_ENSURE_STATUS(parser(op, error_reporter, allocator, &builtin_data));
+
+	for(int round = 0; round < rounds; round++){
+		// A new runner per round, each one allocates temporary eval tensors per Invoke()
+		tflite::micro::KernelRunner runner(*registration, tensors, count, inputs, outputs,
+				builtin_data, error_reporter);
+		TF_LITE_ENSURE_STATUS(runner.InitAndPrepare(reinterpret_cast<const char*>(builtin_data)));
+		for(int i = 0; i < KERNEL_BENCH_REPEATS; i++){
+			uint32_t start = cycle_count();
+			TfLiteStatus status = runner.Invoke();
+			uint32_t cycles = cycle_count() - start;
+			TF_LITE_ENSURE_STATUS(status);
+			result->count++;
+			result->sum += cycles;
+			if(cycles < result->min){
+				result->min = cycles;
+			}
+			if(cycles > result->max){
+				result->max = cycles;
+			}
+		}
+	}
+	return kTfLiteOk;
+}
+
+int kernel_bench_model(const tflite::Model* model, const tflite::MicroOpResolver& op_resolver,
+		uint8_t* memory, size_t memory_size, int rounds, tflite::ErrorReporter* error_reporter,
+		KernelBenchReport report){
+	BenchAllocator allocator(memory, memory_size);
+	const tflite::SubGraph* subgraph = model->subgraphs()->Get(0);
+	int failed = 0;
+	for(int node = 0; node < (int)subgraph->operators()->size(); node++){
+		struct KernelBenchResult result;
+		result.node = node;
+		result.op = "?";
+		result.input = nullptr;
+		result.output = nullptr;
+		result.count = 0;
+		result.min = UINT32_MAX;
+		result.max = 0;
+		result.sum = 0;
+		allocator.reset();
+		result.status = bench_operator(model, subgraph->operators()->Get(node), op_resolver, &allocator,
+				rounds, error_reporter, &result);
+		if(result.status != kTfLiteOk){
+			failed++;
+		}
+		report(&result);
+	}
+	return failed;
+}
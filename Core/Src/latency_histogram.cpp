@@ -0,0 +1,61 @@
+/*
+ * latency_histogram.cpp
+ *
+ *  Latency histogram, see latency_histogram.h
+ */
+
+#include "latency_histogram.h"
+
+#define SUB_BINS (1 << LATENCY_SUB_BITS)
+
+static uint32_t latency_bin(uint32_t ms){
+	if(ms < 2 * SUB_BINS){
+		return ms;
+	}
+	if(ms >= LATENCY_RANGE_MS){
+		return LATENCY_BINS - 1;
+	}
+	// The bits after the leading one select the bin within the octave
+	uint32_t shift = 31 - __CLZ(ms) - LATENCY_SUB_BITS;
+	return SUB_BINS * (shift + 1) + ((ms >> shift) & (SUB_BINS - 1));
+}
+
+// First latency above bin
+static uint32_t latency_bin_end(uint32_t bin){
+	if(bin < 2 * SUB_BINS){
+		return bin + 1;
+	}
+	uint32_t shift = bin / SUB_BINS - 1;
+	return (SUB_BINS + bin % SUB_BINS + 1) << shift;
+}
+
+void init_latency_histogram(struct LatencyHistogram* histogram){
+	for(int i = 0; i < LATENCY_BINS; i++){
+		histogram->bins[i] = 0;
+	}
+	histogram->count = 0;
+	histogram->sum_ms = 0;
+	histogram->max_ms = 0;
+}
+
+void latency_record(struct LatencyHistogram* histogram, uint32_t ms){
+	histogram->bins[latency_bin(ms)]++;
+	histogram->count++;
+	histogram->sum_ms += ms;
+	if(ms > histogram->max_ms){
+		histogram->max_ms = ms;
+	}
+}
+
+uint32_t latency_percentile(struct LatencyHistogram* histogram, uint32_t percent){
+	uint32_t target = (histogram->count * percent + 99) / 100;
+	uint32_t total = 0;
+	for(int i = 0; i < LATENCY_BINS; i++){
+		total += histogram->bins[i];
+		if(total >= target){
+			uint32_t end = latency_bin_end(i);
+			return (end - 1 < histogram->max_ms) ? end - 1 : histogram->max_ms;
+		}
+	}
+	return histogram->max_ms;
+}
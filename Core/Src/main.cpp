@@ -30,10 +30,30 @@
 #include "MFCC21.h"
 #include "linear_to_mel_weight_list.h"
 #include "ben_dct2_f32.h"
+#include "frontend_tables.h"
+#include "mfcc_q31.h"
 #include "ring_buffer.h"
+#include "framer.h"
+#include "frame_preprocess.h"
+#include "vad.h"
+#include "mfcc_frontend.h"
+#include "capture.h"
+#include "latency_histogram.h"
+#include "frame_queue.h"
+#include "duty_cycle.h"
+#include "streaming_head.h"
+#include "detector.h"
+#include "uart_tx.h"
+#include "token_log.h"
+#include "feature_stream.h"
+#include "stage_trace.h"
+#include "op_profiler.h"
+#include "timing_scope.h"
+#include "tensor_arena_size.h"
+#include "memory_watermark.h"
+#include "kernel_bench.h"
 
 #include "tensorflow/lite/micro/all_ops_resolver.h"
-#include "tensorflow/lite/micro/micro_error_reporter.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/kernels/micro_ops.h"
 #include "tensorflow/lite/schema/schema_generated.h"
@@ -48,16 +68,120 @@
 #define TF_LITE_USE_GLOBAL_MIN
 
 #define QUEUELENGTH 2048
+#define DMA_SEGMENTS 2 // Blocks of RecBuff signalled by the DMA callbacks
 #define SYSCLK 80000000
 #define SAMPLINGRATE 9524
 #define N_MFCCS 13
 #define INPUT_SCALE 0.003135847859084606
 #define INPUT_ZERO_POINT -128
+#define FRAME_HOP FRAME_LENGTH // Samples between two feature rows, e.g. FRAME_LENGTH / 2 for 50% overlap
+#define PRE_EMPHASIS 0.0f // Pre-emphasis coefficient, e.g. 0.97, 0 disables it
+#define FRONTEND_WINDOW // Apply the Hann window of the training pipeline (tf.signal.stft)
+
+// Capture
+//#define LOW_LATENCY_CAPTURE // Poll the DMA position and process small blocks instead of half buffers
+#define CAPTURE_MIN_BLOCK 128 // Smallest block in samples, about 13 ms
+//#define LATENCY_HISTOGRAM // Report the age of the newest sample of the inference window when its decision is made
+#define LATENCY_REPORT_DECISIONS 100
+#define LATENCY_SATURATION_MS 10000 // Longer latencies are recorded as this
+
+// Execution model
+//#define DEFERRED_FRONTEND // Front-end in the lowest priority PendSV interrupt, inference preemptible in the main loop
+//#define SLEEP_UNTIL_WORK // Sleep in WFI while no audio block and no inference is pending
+//#define DUTY_CYCLE_REPORT // With SLEEP_UNTIL_WORK: report the share of active cycles periodically
+#define DUTY_CYCLE_PERIOD_MS 5000
+
+// Inference cadence and keyword detector
+#define INFERENCE_STRIDE 1 // New feature rows between two inferences, e.g. 2 to halve the Invoke() calls
+#define TRIGGER_REFRACTORY MIN_DIST // New feature rows after a detected keyword before the next inference
+#define DETECTOR_SMOOTHING SMOOTHING_MEAN // Or SMOOTHING_MAX
+#define DETECTOR_LENGTH 1 // Inferences the outputs are smoothed over, 1 is the plain argmax
+#define DETECTOR_THRESHOLDS {-128, -128, -128} // Smoothed int8 output needed for noise, keyword and silence
+
+// Reports
+#define NONBLOCKING_UART // Send the reports by DMA from a bounded queue instead of blocking the audio processing
+#define STATUS_REPORT_INFERENCES 50 // Report lost frames and dropped messages every ... inferences
+//#define TOKENIZED_LOG // Send log_tokens.h indices and raw arguments instead of text, decode with Tests/token_decoder.py
+
+// Voice activity gate, the thresholds are int8 values of the first mfcc and need calibration
+//#define VAD_GATE // Skip inference while the whole window is quiet
+#define VAD_THRESHOLD_ON 90
+#define VAD_THRESHOLD_OFF 85
+#define VAD_HANGOVER 5 // rows
+
+#ifdef FRONTEND_WINDOW
+#define WINDOW_F32 hann_window_f32
+#define WINDOW_Q15 hann_window_q15
+#else
+#define WINDOW_F32 NULL
+#define WINDOW_Q15 NULL
+#endif
+
+// Front-end selection
+//#define FRONTEND_FIXED_POINT // Integer-only q31 front-end instead of float32
+//#define FRONTEND_COMPARE // With FRONTEND_FIXED_POINT: also run the float32 front-end and report cycles and deviation
+//#define FRONTEND_POWER_SPECTRUM // Float32 front-end with squared magnitude and approximate log2 (Tests/power_spectrum.py)
+//#define FRONTEND_TEMPLATE // Float32 front-end from the MfccFrontend template below instead of the generated tables
+//#define DCT_BENCHMARK // Compare the truncated DCT with ben_dct2_f32 once at startup
+//#define FRONTEND_BUDGET // Report the front-end cycles per DMA half against the real-time budget
+//#define FRONTEND_DUMP // Print the stages of one float32 frame for Tests/frontend_regression.py
+#define FRONTEND_DUMP_FRAME 20 // Index of the dumped frame, about two seconds after start
+//#define FRONTEND_STAGE_BENCHMARK // Report the time per stage of the float32 front-end for every frame
+//#define STAGING_BENCHMARK // Report the cycles spent on staging the model input for every inference
+//#define STREAMING_INFERENCE // Only compute the new rows of the first two convolutions per inference (streaming_head.h)
+//#define STREAMING_BENCHMARK // With STREAMING_INFERENCE: also run the full model and compare cycles and outputs
+//#define FEATURE_STREAM // Send the stages of every float32 frame in binary records for Tests/stream_receiver.cpp
+#define FEATURE_STREAM_STAGES STREAM_ALL_STAGES // e.g. STREAM_STAGE(STREAM_AUDIO) | STREAM_STAGE(STREAM_INT8)
+#define FEATURE_STREAM_BAUDRATE 921600 // All stages are about 4.5 kB per frame, 45% of this rate
+//#define STAGE_TRACE // Timestamp the path from the DMA callback to the decision, send T to dump (Tests/stage_trace.py)
+//#define OP_PROFILER // Measure the cycles of every node of the model, also in release builds
+#define OP_PROFILE_REPORT_INVOKES 100 // Report the per-node table every ... Invoke() calls
+//#define TIMING_REPORT // Report the TimingScope slots (timing_scope.h) with the status every STATUS_REPORT_INFERENCES
+//#define MEMORY_WATERMARK // Report the deepest stack per stage and the heap (memory_watermark.h) with the status
+//#define KERNEL_BENCHMARK // Time every kernel of the model alone with KernelRunner once at startup (kernel_bench.h)
+#define KERNEL_BENCH_ROUNDS 8 // KernelRunners per kernel, each one is invoked KERNEL_BENCH_REPEATS times
+
+#if defined(FRONTEND_BUDGET) && defined(FRONTEND_COMPARE)
+#error "FRONTEND_BUDGET and FRONTEND_COMPARE both use the cycle counter"
+#endif
+#if defined(FRONTEND_COMPARE) && !defined(FRONTEND_FIXED_POINT)
+#error "FRONTEND_COMPARE compares the q31 front-end of FRONTEND_FIXED_POINT with the float32 one"
+#endif
+#if (defined(FRONTEND_DUMP) || defined(FRONTEND_STAGE_BENCHMARK) || defined(FEATURE_STREAM)) && \
+	(defined(FRONTEND_BUDGET) || defined(FRONTEND_FIXED_POINT) || defined(FRONTEND_TEMPLATE))
+#error "FRONTEND_DUMP, FRONTEND_STAGE_BENCHMARK and FEATURE_STREAM trace the table based float32 front-end and use the cycle counter"
+#endif
+#if defined(DEFERRED_FRONTEND) && (defined(FRONTEND_BUDGET) || defined(FRONTEND_COMPARE) || \
+	defined(FRONTEND_DUMP) || defined(FRONTEND_STAGE_BENCHMARK) || defined(FEATURE_STREAM))
+#error "The front-end diagnostics restart the timer of CycleCounter.h, which would corrupt the inference timing"
+#endif
+#if defined(STREAMING_BENCHMARK) && !defined(STREAMING_INFERENCE)
+#error "STREAMING_BENCHMARK compares STREAMING_INFERENCE with the full model"
+#endif
+#if defined(OP_PROFILER) && defined(STREAMING_BENCHMARK)
+#error "OP_PROFILER would mix the streamed and the full Invoke() of STREAMING_BENCHMARK"
+#endif
+#if defined(DUTY_CYCLE_REPORT) && !defined(SLEEP_UNTIL_WORK)
+#error "DUTY_CYCLE_REPORT measures the time spent in the sleep of SLEEP_UNTIL_WORK"
+#endif
+#if defined(FEATURE_STREAM) && !defined(NONBLOCKING_UART)
+#error "FEATURE_STREAM sends its records by DMA through uart_tx"
+#endif
+#if defined(DEFERRED_FRONTEND) && defined(LOW_LATENCY_CAPTURE)
+#error "LOW_LATENCY_CAPTURE polls the DMA from the main loop, DEFERRED_FRONTEND is only pended by the DMA callbacks"
+#endif
+#if LATENCY_SATURATION_MS >= LATENCY_RANGE_MS
+#error "LATENCY_SATURATION_MS must be inside the range of latency_histogram.h"
+#endif
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
-
+#ifdef FRONTEND_TEMPLATE
+// Frame length, mel bands, MFCCs, sampling rate and band edges of the template front-end
+typedef MfccFrontend<FRAME_LENGTH, N_MEL_BANDS, N_MFCCS, SAMPLINGRATE, 80, 4700> FrontendConfig;
+static_assert(FrontendConfig::num_mfcc == N_MFCC, "the ring buffer rows need one entry per MFCC");
+#endif
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
@@ -85,6 +209,8 @@ namespace {
   TfLiteTensor* model_output = nullptr;
 } // namespace
 
+DMA_HandleTypeDef hdma_usart1_tx;
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -100,8 +226,8 @@ static void MX_USART1_Init(void);
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
-volatile bool firstHalfFull = false;
-volatile bool secondHalfFull = false;
+struct FrameQueue frame_queue; // Filled halves of RecBuff, from the DMA callbacks to the main loop
+volatile uint32_t dma_passes = 0; // Completed passes of the DMA over RecBuff
 
 int32_t RecBuff[QUEUELENGTH];
 int16_t amplitude;
@@ -145,16 +271,149 @@ GETCHAR_PROTOTYPE
 }
 
 
+#ifdef STAGE_TRACE
+static struct StageTrace stage_trace;
+#endif
+
+#ifdef TIMING_REPORT
+static const int timing_frontend = timing_slot("frontend");
+static const int timing_invoke = timing_slot("invoke");
+static const int timing_inference = timing_slot("inference");
+#endif
+
+#ifdef MEMORY_WATERMARK
+static struct MemoryWatermark memory_watermark;
+#endif
+
+#ifdef NONBLOCKING_UART
+static struct UartTx uart_tx;
+#ifdef FEATURE_STREAM
+static struct FeatureStream feature_stream;
+#endif
+
+void HAL_USART_TxCpltCallback(USART_HandleTypeDef *husart)
+{
+	uart_tx_complete(&uart_tx);
+}
+
+void HAL_USART_ErrorCallback(USART_HandleTypeDef *husart)
+{
+	uart_tx_complete(&uart_tx);
+}
+#endif
+
+/**
+  * @brief Reports a line without waiting for the UART if NONBLOCKING_UART is set
+  * @param text, length
+  * @retval None
+  */
+void report(const char* text, int length){
+#ifdef NONBLOCKING_UART
+	uart_tx_write(&uart_tx, text, length);
+#else
+	HAL_USART_Transmit(&husart1, (uint8_t *)text, length, 100);
+#endif
+}
+
+/**
+  * @brief Reports an event, with NONBLOCKING_UART prefixed with the HAL tick in ms
+  *        since it may leave the queue much later
+  * @param text, length
+  * @retval None
+  */
+void report_event(const char* text, int length){
+#ifdef NONBLOCKING_UART
+	uart_tx_event(&uart_tx, HAL_GetTick(), text, length);
+#else
+	HAL_USART_Transmit(&husart1, (uint8_t *)text, length, 100);
+#endif
+}
+
+/**
+  * @brief Reports a line that must not be dropped, waits for the queue first
+  * @param text, length
+  * @retval None
+  */
+void report_blocking(const char* text, int length){
+#ifdef NONBLOCKING_UART
+	uart_tx_flush(&uart_tx);
+#endif
+	HAL_USART_Transmit(&husart1, (uint8_t *)text, length, 100);
+}
+
+#ifndef TOKENIZED_LOG
+static const char* const log_formats[LOG_TOKEN_COUNT] = {
+	LOG_TOKENS(LOG_TOKEN_FORMAT)
+};
+#endif
+
+/**
+  * @brief Reports an entry of log_tokens.h, as text through report_event or with
+  *        TOKENIZED_LOG as a binary packet
+  * @param token, n number of int32 arguments, arguments
+  * @retval None
+  */
+void log_event(enum LogToken token, int n, ...){
+	va_list args;
+	va_start(args, n);
+#ifdef TOKENIZED_LOG
+	uint8_t packet[TOKEN_LOG_PACKET_MAX];
+	int length = token_log_vpack(packet, token, HAL_GetTick(), n, args);
+	report((const char*)packet, length);
+#else
+	char text[128];
+	int length = vsnprintf(text, sizeof(text), log_formats[token], args);
+	if(length > (int)sizeof(text) - 1){
+		length = sizeof(text) - 1;
+	}
+	report_event(text, length);
+#endif
+	va_end(args);
+}
+
+// The half callback signals the first half of RecBuff, the complete callback the
+// second one. The DMA is writing into the respective other half at that point.
 void HAL_DFSDM_FilterRegConvCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
 {
-	firstHalfFull = true;
+	frame_queue_push(&frame_queue, &RecBuff[QUEUELENGTH/2], QUEUELENGTH/2);
+#ifdef STAGE_TRACE
+	stage_trace_record(&stage_trace, TRACE_DMA, 2 * dma_passes + 1);
+#endif
+	dma_passes++;
+#ifdef DEFERRED_FRONTEND
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#endif
 }
 
 void HAL_DFSDM_FilterRegConvHalfCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter)
 {
-	secondHalfFull = true;
+	frame_queue_push(&frame_queue, &RecBuff[0], QUEUELENGTH/2);
+#ifdef STAGE_TRACE
+	stage_trace_record(&stage_trace, TRACE_DMA, 2 * dma_passes);
+#endif
+#ifdef DEFERRED_FRONTEND
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+#endif
 }
 
+#if defined(LOW_LATENCY_CAPTURE) || defined(LATENCY_HISTOGRAM)
+/**
+  * @brief Updates the capture with the current write position of the DMA
+  * @param capture
+  * @retval Samples written since the start
+  */
+uint32_t update_capture(struct Capture* capture){
+	uint32_t passes;
+	uint16_t remaining;
+	do {
+		passes = dma_passes;
+		remaining = __HAL_DMA_GET_COUNTER(&hdma_dfsdm1_flt0);
+	} while(passes != dma_passes);
+
+	return capture_update(capture, passes, remaining);
+}
+#endif
+
 /**
   * @brief Convert the float mfccs into int8 after normalization
   * @param mfccs_float, mfccs_int8
@@ -166,6 +425,730 @@ void normalize_mfccs(float32_t* mfccs_float, int8_t* mfccs_int8){
 	}
 }
 
+/**
+  * @brief Float32 front-end, computes the int8 mfccs of one frame of DFSDM samples
+  * @param samples, buffer1, buffer2, rfft_frame, mfccs_int8
+  * @retval None
+  */
+void calc_mfccs_f32(const int32_t* samples, float32_t* buffer1, float32_t* buffer2,
+		arm_rfft_fast_instance_f32* rfft_frame, int8_t* mfccs_int8){
+	preprocess_frame_f32(samples, buffer1, FRAME_LENGTH, PRE_EMPHASIS, WINDOW_F32);
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_PREPROCESS);
+#endif
+	arm_rfft_fast_f32(rfft_frame, buffer1, buffer2, 0);
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_FFT);
+#endif
+#ifdef FRONTEND_POWER_SPECTRUM
+	arm_cmplx_mag_squared_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_MAGNITUDE);
+#endif
+	calc_log_mel_spectrogram_power(buffer1, buffer2);
+#else
+	arm_cmplx_mag_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_MAGNITUDE);
+#endif
+	calc_log_mel_spectrogram(buffer1, buffer2);
+#endif
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_MEL);
+#endif
+	dct2_truncated_int8(buffer2, mfccs_int8);
+#ifdef STAGE_TRACE
+	stage_trace_frame_stage(&stage_trace, TRACE_DCT);
+#endif
+}
+
+#ifdef DCT_BENCHMARK
+/**
+  * @brief Runs ben_dct2_f32 and the truncated DCT on a synthetic log mel spectrogram,
+  *        reports the cycles and the largest deviation over the USART
+  * @param None
+  * @retval None
+  */
+void benchmark_dct2(void){
+	char buf[80];
+	int buf_len = 0;
+	float32_t log_mel[N_MEL_BANDS];
+	float32_t inline_buffer[N_MEL_BANDS];
+	float32_t state[2 * N_MEL_BANDS];
+	float32_t mfccs_ref[N_MFCCS];
+	float32_t mfccs_trunc[N_MFCCS];
+	int8_t mfccs_int8_ref[N_MFCCS];
+	int8_t mfccs_int8_trunc[N_MFCCS];
+	arm_rfft_fast_instance_f32 rfft_dct;
+	arm_rfft_fast_init_f32(&rfft_dct, N_MEL_BANDS);
+
+	for(int i = 0; i < N_MEL_BANDS; i++){
+		log_mel[i] = 8.0f + 4.0f * arm_sin_f32(0.3f * i) - 0.05f * i;
+	}
+
+	// ben_dct2_f32 overwrites its input
+	memcpy(inline_buffer, log_mel, sizeof(log_mel));
+	ResetTimer();
+	StartTimer();
+	ben_dct2_f32(inline_buffer, state, mfccs_ref, &rfft_dct);
+	normalize_mfccs(mfccs_ref, mfccs_int8_ref);
+	StopTimer();
+	unsigned int cycles_ref = getCycles();
+
+	ResetTimer();
+	StartTimer();
+	dct2_truncated_f32(log_mel, mfccs_trunc);
+	StopTimer();
+	unsigned int cycles_trunc = getCycles();
+
+	ResetTimer();
+	StartTimer();
+	dct2_truncated_int8(log_mel, mfccs_int8_trunc);
+	StopTimer();
+	unsigned int cycles_int8 = getCycles();
+
+	float32_t max_error = 0;
+	int max_deviation = 0;
+	for(int i = 0; i < N_MFCCS; i++){
+		float32_t error = fabsf(mfccs_trunc[i] - mfccs_ref[i]);
+		if(error > max_error){
+			max_error = error;
+		}
+		int deviation = abs(mfccs_int8_trunc[i] - mfccs_int8_ref[i]);
+		if(deviation > max_deviation){
+			max_deviation = deviation;
+		}
+	}
+
+	buf_len = sprintf(buf, "DCT ref %u trunc %u int8 %u cycles\r\n", cycles_ref, cycles_trunc, cycles_int8);
+	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+	buf_len = sprintf(buf, "DCT max error %d e-6, int8 dev %d\r\n", (int)(max_error * 1e6f), max_deviation);
+	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+}
+#endif
+
+#ifdef STAGING_BENCHMARK
+/**
+  * @brief Times the row by row copy with a modulo per row, as the ring buffer used to
+  *        stage the model input, against the copy of the contiguous window
+  * @param rb, batch
+  * @retval None
+  */
+void benchmark_staging(struct RingBuffer* rb, int8_t* batch){
+	char buf[64];
+	int buf_len = 0;
+
+	ResetTimer();
+	StartTimer();
+	for(int i = 0; i < BUFFERSIZE; i++){
+		for(int j = 0; j < N_MFCC; j++){
+			batch[i * N_MFCC + j] = rb->data[(i + rb->buffer_ptr) % BUFFERSIZE][j];
+		}
+	}
+	StopTimer();
+	unsigned int cycles_modulo = getCycles();
+
+	ResetTimer();
+	StartTimer();
+	memcpy(batch, get_inference_window(rb), BUFFERSIZE * N_MFCC);
+	StopTimer();
+	unsigned int cycles_window = getCycles();
+
+	bool equal = true;
+	for(int i = 0; i < BUFFERSIZE; i++){
+		if(memcmp(&batch[i * N_MFCC], rb->data[(i + rb->buffer_ptr) % BUFFERSIZE], N_MFCC) != 0){
+			equal = false;
+		}
+	}
+
+	buf_len = sprintf(buf, "Staging modulo %u window %u cycles%s\r\n", cycles_modulo, cycles_window,
+			equal ? "" : ", MISMATCH");
+	report(buf, buf_len);
+}
+#endif
+
+#ifdef STREAMING_BENCHMARK
+/**
+  * @brief Runs the full model on the same window as the streamed inference before and
+  *        compares cycles and outputs
+  * @param head, batch: copy of the model input, cycles_stream, output: of the streamed inference
+  * @retval None
+  */
+void benchmark_streaming(struct StreamingHead* head, const int8_t* batch, unsigned int cycles_stream, const int8_t* output){
+	char buf[64];
+	int buf_len = 0;
+
+	// The arena reuses the input tensor for later layers
+	memcpy(model_input->data.int8, batch, BUFFERSIZE * N_MFCC);
+	head->enabled = false;
+	ResetTimer();
+	StartTimer();
+	interpreter->Invoke();
+	StopTimer();
+	unsigned int cycles_full = getCycles();
+	head->enabled = true;
+
+	bool equal = (memcmp(model_output->data.int8, output, 3) == 0);
+	buf_len = sprintf(buf, "Streaming %u full %u cycles, %lu rows%s\r\n", cycles_stream, cycles_full,
+			head->rows_computed, equal ? "" : ", MISMATCH");
+	report(buf, buf_len);
+}
+#endif
+
+#ifdef OP_PROFILER
+/**
+  * @brief Reports min, mean and max cycles of every node and its share of the
+  *        total, waits for the UART since it is a burst of lines
+  * @param profiler
+  * @retval None
+  */
+void report_op_profile(const OpProfiler* profiler){
+	char buf[96];
+	int buf_len = 0;
+	uint64_t total = 0;
+	for(int i = 0; i < profiler->nodes; i++){
+		total += profiler->stats[i].sum;
+	}
+	for(int i = 0; i < profiler->nodes; i++){
+		const struct OpProfileStats* stats = &profiler->stats[i];
+		if(stats->count == 0){
+			continue;
+		}
+		uint32_t permille = (total > 0) ? (uint32_t)(stats->sum * 1000 / total) : 0;
+		buf_len = sprintf(buf, "Op %2d %-16.16s min %lu mean %lu max %lu cycles, %lu.%lu%%\r\n", i,
+				stats->name != nullptr ? stats->name : "?", stats->min, (uint32_t)(stats->sum / stats->count),
+				stats->max, permille / 10, permille % 10);
+		report_blocking(buf, buf_len);
+	}
+	uint32_t invokes = profiler->stats[0].count;
+	buf_len = sprintf(buf, "Ops %lu invokes, mean %lu cycles, %lu events dropped\r\n", invokes,
+			invokes > 0 ? (uint32_t)(total / invokes) : 0, profiler->dropped);
+	report_blocking(buf, buf_len);
+}
+#endif
+
+#ifdef KERNEL_BENCHMARK
+/**
+  * @brief Reports the shapes and min, mean and max cycles of one kernel of
+  *        kernel_bench_model(), waits for the UART since it runs at startup
+  * @param result
+  * @retval None
+  */
+void report_kernel_bench(const struct KernelBenchResult* result){
+	char buf[128];
+	int buf_len = sprintf(buf, "Kernel %2d %-16.16s", result->node, result->op);
+	const TfLiteIntArray* shapes[2] = {result->input, result->output};
+	for(int i = 0; i < 2; i++){
+		buf_len += sprintf(&buf[buf_len], i == 0 ? " " : " -> ");
+		for(int j = 0; shapes[i] != nullptr && j < shapes[i]->size && j < 4; j++){
+			buf_len += sprintf(&buf[buf_len], j > 0 ? "x%d" : "%d", shapes[i]->data[j]);
+		}
+	}
+	if(result->status != kTfLiteOk || result->count == 0){
+		buf_len += sprintf(&buf[buf_len], " failed\r\n");
+	} else {
+		buf_len += sprintf(&buf[buf_len], " min %lu mean %lu max %lu cycles\r\n", result->min,
+				(uint32_t)(result->sum / result->count), result->max);
+	}
+	report_blocking(buf, buf_len);
+}
+#endif
+
+#ifdef TIMING_REPORT
+/**
+  * @brief Reports count, min, mean, p99 and max cycles of every timing slot
+  * @param None
+  * @retval None
+  */
+void report_timing(void){
+	char buf[96];
+	for(int i = 0; i < timing_slot_count(); i++){
+		const struct TimingSlot* slot = timing_get_slot(i);
+		if(slot->count == 0){
+			continue;
+		}
+		int buf_len = sprintf(buf, "T %-10.10s n %lu min %lu mean %lu p99 %lu max %lu\r\n", slot->name,
+				slot->count, slot->min, (uint32_t)(slot->sum / slot->count), timing_percentile(i, 99), slot->max);
+		report(buf, buf_len);
+	}
+}
+#endif
+
+#ifdef FRONTEND_DUMP
+/**
+  * @brief Prints a section marker and one value per line as parsed by Tests/frontend_regression.py
+  * @param name, values, n
+  * @retval None
+  */
+void dump_values(const char* name, const float32_t* values, int n){
+	char buf[32];
+	int buf_len = sprintf(buf, "%s\r\n", name);
+	report_blocking(buf, buf_len);
+	for(int i = 0; i < n; i++){
+		buf_len = sprintf(buf, "%.7g\r\n", values[i]);
+		report_blocking(buf, buf_len);
+	}
+}
+#endif
+
+#if defined(FRONTEND_DUMP) || defined(FRONTEND_STAGE_BENCHMARK) || defined(FEATURE_STREAM)
+/**
+  * @brief Float32 front-end as calc_mfccs_f32, stage by stage. FRONTEND_DUMP prints the
+  *        input and the output of every stage of frame FRONTEND_DUMP_FRAME for
+  *        Tests/frontend_regression.py, FRONTEND_STAGE_BENCHMARK reports the time per stage,
+  *        FEATURE_STREAM sends the stages of every frame
+  * @param samples, buffer1, buffer2, rfft_frame, mfccs_int8
+  * @retval None
+  */
+void trace_frontend_stages(const int32_t* samples, float32_t* buffer1, float32_t* buffer2,
+		arm_rfft_fast_instance_f32* rfft_frame, int8_t* mfccs_int8){
+	unsigned int cycles[5];
+#ifdef FRONTEND_DUMP
+	static int frame_index = 0;
+	bool dump = (frame_index++ == FRONTEND_DUMP_FRAME);
+	float32_t mfccs[N_MFCCS];
+
+	if(dump){
+		for(int i = 0; i < FRAME_LENGTH; i++){
+			buffer2[i] = (float32_t)(samples[i] >> 8);
+		}
+		dump_values("Audio", buffer2, FRAME_LENGTH);
+	}
+#endif
+#ifdef FEATURE_STREAM
+	feature_stream_begin(&feature_stream);
+	feature_stream_add_audio(&feature_stream, samples, FRAME_LENGTH);
+#endif
+
+	ResetTimer();
+	StartTimer();
+	preprocess_frame_f32(samples, buffer1, FRAME_LENGTH, PRE_EMPHASIS, WINDOW_F32);
+	StopTimer();
+	cycles[0] = getCycles();
+
+	ResetTimer();
+	StartTimer();
+	arm_rfft_fast_f32(rfft_frame, buffer1, buffer2, 0);
+	StopTimer();
+	cycles[1] = getCycles();
+
+	ResetTimer();
+	StartTimer();
+#ifdef FRONTEND_POWER_SPECTRUM
+	arm_cmplx_mag_squared_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#else
+	arm_cmplx_mag_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#endif
+	StopTimer();
+	cycles[2] = getCycles();
+
+#ifdef FRONTEND_DUMP
+	if(dump){
+#ifdef FRONTEND_POWER_SPECTRUM
+		dump_values("Power", buffer1, FRAME_LENGTH/2);
+#else
+		dump_values("Magnitude", buffer1, FRAME_LENGTH/2);
+#endif
+	}
+#endif
+#ifdef FEATURE_STREAM
+	feature_stream_add_f32(&feature_stream, STREAM_SPECTRUM, buffer1, FRAME_LENGTH/2);
+#endif
+
+	ResetTimer();
+	StartTimer();
+#ifdef FRONTEND_POWER_SPECTRUM
+	calc_log_mel_spectrogram_power(buffer1, buffer2);
+#else
+	calc_log_mel_spectrogram(buffer1, buffer2);
+#endif
+	StopTimer();
+	cycles[3] = getCycles();
+
+	ResetTimer();
+	StartTimer();
+	dct2_truncated_int8(buffer2, mfccs_int8);
+	StopTimer();
+	cycles[4] = getCycles();
+
+#ifdef FRONTEND_DUMP
+	if(dump){
+		dump_values("LMS", buffer2, N_MEL_BANDS);
+		dct2_truncated_f32(buffer2, mfccs);
+		dump_values("MFCCs", mfccs, N_MFCCS);
+		for(int i = 0; i < N_MFCCS; i++){
+			mfccs[i] = mfccs_int8[i];
+		}
+		dump_values("Int8", mfccs, N_MFCCS);
+	}
+#endif
+#ifdef FEATURE_STREAM
+	feature_stream_add_f32(&feature_stream, STREAM_LMS, buffer2, N_MEL_BANDS);
+	if(feature_stream_wants(&feature_stream, STREAM_MFCC)){
+		float32_t mfccs_f32[N_MFCCS];
+		dct2_truncated_f32(buffer2, mfccs_f32);
+		feature_stream_add_f32(&feature_stream, STREAM_MFCC, mfccs_f32, N_MFCCS);
+	}
+	feature_stream_add_int8(&feature_stream, mfccs_int8, N_MFCCS);
+	feature_stream_end(&feature_stream);
+#endif
+
+#ifdef FRONTEND_STAGE_BENCHMARK
+	// ns = cycles * 1e9 / SYSCLK
+	char buf[96];
+	uint32_t ns[5];
+	for(int i = 0; i < 5; i++){
+		ns[i] = (uint32_t)((uint64_t)cycles[i] * 1000000000 / SYSCLK);
+	}
+	int buf_len = sprintf(buf, "FE ns pre %lu fft %lu mag %lu mel %lu dct %lu\r\n",
+			ns[0], ns[1], ns[2], ns[3], ns[4]);
+	report(buf, buf_len);
+#else
+	(void)cycles;
+#endif
+}
+#endif
+
+
+
+// Front-end state, written by process_audio only
+#if (!defined(FRONTEND_FIXED_POINT) && !defined(FRONTEND_TEMPLATE)) || defined(FRONTEND_COMPARE)
+static float32_t buffer1[FRAME_LENGTH];
+static float32_t buffer2[FRAME_LENGTH];
+static arm_rfft_fast_instance_f32 rfft_struct_v1;
+#endif
+#ifdef FRONTEND_FIXED_POINT
+static q31_t q31_buffer1[FRAME_LENGTH];
+static q31_t q31_buffer2[2 * FRAME_LENGTH];
+static struct MfccQ31 mfcc_q31;
+#endif
+#ifdef FRONTEND_TEMPLATE
+static FrontendConfig frontend;
+#endif
+static struct Framer framer;
+#if defined(LOW_LATENCY_CAPTURE) || defined(LATENCY_HISTOGRAM)
+static struct Capture capture;
+#endif
+#ifdef LATENCY_HISTOGRAM
+static struct LatencyHistogram latency;
+static uint32_t row_end_sample[BUFFERSIZE]; // Samples since the start at the end of every row, by rb.version
+#endif
+
+// Shared with the inference in the main loop
+static struct RingBuffer rb;
+#ifdef VAD_GATE
+static struct Vad vad;
+#endif
+#ifdef DUTY_CYCLE_REPORT
+static struct DutyCycle duty_cycle;
+#endif
+
+/**
+  * @brief Initializes the front-end, before the DMA is started
+  * @param None
+  * @retval None
+  */
+void init_frontend(void){
+	init_ring_buffer(&rb);
+	init_framer(&framer, FRAME_HOP);
+#if defined(LOW_LATENCY_CAPTURE) || defined(LATENCY_HISTOGRAM)
+	init_capture(&capture, RecBuff, QUEUELENGTH);
+#endif
+#ifdef LATENCY_HISTOGRAM
+	init_latency_histogram(&latency);
+#endif
+#ifdef VAD_GATE
+	init_vad(&vad, VAD_THRESHOLD_ON, VAD_THRESHOLD_OFF, VAD_HANGOVER);
+#endif
+#if (!defined(FRONTEND_FIXED_POINT) && !defined(FRONTEND_TEMPLATE)) || defined(FRONTEND_COMPARE)
+	if(arm_rfft_fast_init_f32(&rfft_struct_v1, FRAME_LENGTH) != ARM_MATH_SUCCESS){
+		Error_Handler();
+	}
+#endif
+#ifdef FRONTEND_FIXED_POINT
+	if(init_mfcc_q31(&mfcc_q31, FRAME_LENGTH, (q15_t)(PRE_EMPHASIS * 32768), WINDOW_Q15) != ARM_MATH_SUCCESS){
+		Error_Handler();
+	}
+#endif
+#ifdef FRONTEND_TEMPLATE
+	if(frontend.init(INPUT_SCALE, INPUT_ZERO_POINT, PRE_EMPHASIS, WINDOW_F32 != NULL) != ARM_MATH_SUCCESS){
+		Error_Handler();
+	}
+#endif
+}
+
+/**
+  * @brief Turns all pending audio blocks into feature rows. Runs in the main loop or,
+  *        with DEFERRED_FRONTEND, in the PendSV interrupt
+  * @param None
+  * @retval None
+  */
+void process_audio(void){
+#if defined(FRONTEND_COMPARE) || defined(FRONTEND_BUDGET)
+	char buf[64];
+	int buf_len = 0;
+#endif
+	int8_t mfccs_int8[N_MFCCS];
+#ifdef FRONTEND_COMPARE
+	int8_t mfccs_int8_f32[N_MFCCS];
+	static int max_deviation = 0;
+#endif
+
+	while(1){
+		const int32_t* block = nullptr;
+		uint16_t block_length = 0;
+		bool discontinuity = false;
+#ifdef LOW_LATENCY_CAPTURE
+		uint32_t overruns = capture.overruns;
+		update_capture(&capture);
+		block_length = capture_next_block(&capture, CAPTURE_MIN_BLOCK, &block);
+		discontinuity = (capture.overruns != overruns);
+#else
+		struct FrameDescriptor descriptor;
+		uint32_t missed = 0;
+		if(frame_queue_pop(&frame_queue, &descriptor, &missed)){
+			if(frame_queue_check_late(&frame_queue, &descriptor, DMA_SEGMENTS)){
+				// The DMA is already overwriting this half
+				discontinuity = true;
+			} else {
+				block = descriptor.samples;
+				block_length = descriptor.length;
+				discontinuity = (missed > 0);
+			}
+		}
+#endif
+
+		if(discontinuity){
+			// Partial frames must not be continued with samples from after the gap
+			framer_reset(&framer);
+			mark_discontinuity(&rb);
+#ifdef FEATURE_STREAM
+			feature_stream_mark_discontinuity(&feature_stream);
+#endif
+#ifdef LOW_LATENCY_CAPTURE
+			log_event(LOG_GAP_CAPTURE, 2, capture.overruns, capture.dropped);
+#else
+			log_event(LOG_GAP, 3, frame_queue.lost, frame_queue.late, frame_queue.overruns);
+#endif
+		}
+
+		if(block != nullptr){
+#ifdef FRONTEND_BUDGET
+			int rows = 0;
+			ResetTimer();
+			StartTimer();
+#endif
+			uint16_t consumed = 0;
+			while(consumed < block_length){
+				consumed += framer_push(&framer, &block[consumed], block_length - consumed);
+				if(!framer_frame_ready(&framer)){
+					continue;
+				}
+
+				const int32_t* frame = framer.samples;
+#ifdef TIMING_REPORT
+				// Until the row is in the ring buffer, also when this runs in PendSV
+				TimingScope frontend_scope(timing_frontend);
+#endif
+#ifdef STAGE_TRACE
+				// The id of the TRACE_DMA event of the half holding the newest sample of the frame
+#ifdef LOW_LATENCY_CAPTURE
+				stage_trace_begin_frame(&stage_trace, (capture.read + consumed - 1) / (QUEUELENGTH/2));
+#else
+				stage_trace_begin_frame(&stage_trace, descriptor.sequence);
+#endif
+#endif
+#ifdef FRONTEND_COMPARE
+				ResetTimer();
+				StartTimer();
+				calc_mfccs_f32(frame, buffer1, buffer2, &rfft_struct_v1, mfccs_int8_f32);
+				StopTimer();
+				unsigned int cycles_f32 = getCycles();
+				ResetTimer();
+				StartTimer();
+				calc_mfccs_q31(&mfcc_q31, frame, q31_buffer1, q31_buffer2, mfccs_int8);
+				StopTimer();
+				unsigned int cycles_q31 = getCycles();
+
+				int deviation = 0;
+				for(int i = 0; i < N_MFCCS; i++){
+					int d = abs(mfccs_int8[i] - mfccs_int8_f32[i]);
+					if(d > deviation){
+						deviation = d;
+					}
+				}
+				if(deviation > max_deviation){
+					max_deviation = deviation;
+				}
+				buf_len = sprintf(buf, "FE f32/q31 %u/%u dev %d/%d\r\n", cycles_f32, cycles_q31, deviation, max_deviation);
+				report(buf, buf_len);
+#elif defined(FRONTEND_FIXED_POINT)
+				calc_mfccs_q31(&mfcc_q31, frame, q31_buffer1, q31_buffer2, mfccs_int8);
+#elif defined(FRONTEND_TEMPLATE)
+				frontend.calc_mfccs_int8(frame, mfccs_int8);
+#elif defined(FRONTEND_DUMP) || defined(FRONTEND_STAGE_BENCHMARK) || defined(FEATURE_STREAM)
+				trace_frontend_stages(frame, buffer1, buffer2, &rfft_struct_v1, mfccs_int8);
+#else
+				calc_mfccs_f32(frame, buffer1, buffer2, &rfft_struct_v1, mfccs_int8);
+#endif
+#ifdef LATENCY_HISTOGRAM
+#ifdef LOW_LATENCY_CAPTURE
+				row_end_sample[rb.version % BUFFERSIZE] = capture.read + consumed;
+#else
+				row_end_sample[rb.version % BUFFERSIZE] = descriptor.sequence * descriptor.length + consumed;
+#endif
+#endif
+				insert_data(&rb, mfccs_int8);
+#ifdef STAGE_TRACE
+				stage_trace_frame_stage(&stage_trace, TRACE_ROW);
+#endif
+				framer_advance(&framer);
+#ifdef VAD_GATE
+				vad_update(&vad, mfccs_int8);
+#endif
+#ifdef FRONTEND_BUDGET
+				rows++;
+#endif
+			}
+#ifdef FRONTEND_BUDGET
+			StopTimer();
+			buf_len = sprintf(buf, "FE %u/%lu cycles, %d rows\r\n", getCycles(),
+					(uint32_t)((uint64_t)SYSCLK * block_length / SAMPLINGRATE), rows);
+			report(buf, buf_len);
+#endif
+
+#ifdef LOW_LATENCY_CAPTURE
+			// The DMA caught up while the block was processed, its frames may be torn
+			update_capture(&capture);
+			if(capture_check_late(&capture)){
+				mark_discontinuity(&rb);
+#ifdef FEATURE_STREAM
+				feature_stream_mark_discontinuity(&feature_stream);
+#endif
+			}
+			capture_consume(&capture, block_length);
+#else
+			// The DMA caught up while the half was processed, its last frames may be torn
+			if(frame_queue_check_late(&frame_queue, &descriptor, DMA_SEGMENTS)){
+				mark_discontinuity(&rb);
+#ifdef FEATURE_STREAM
+				feature_stream_mark_discontinuity(&feature_stream);
+#endif
+			}
+#endif
+		} else if(!discontinuity){
+			return;
+		}
+	}
+}
+
+#ifdef LATENCY_HISTOGRAM
+/**
+  * @brief Records the detection latency, the age of the newest sample of the inference
+  *        window when its decision is made, and reports the distribution periodically
+  * @param rows_inserted Version of the window as returned by copy_inference_batch
+  * @retval None
+  */
+void record_detection_latency(uint32_t rows_inserted){
+	// Absolute sample counts, so latencies beyond one DMA buffer do not wrap
+	uint32_t written = update_capture(&capture);
+	int32_t age = (int32_t)(written - row_end_sample[(rows_inserted - 1) % BUFFERSIZE]);
+	uint32_t ms = (age > 0) ? (uint32_t)((uint64_t)age * 1000 / SAMPLINGRATE) : 0;
+	latency_record(&latency, (ms < LATENCY_SATURATION_MS) ? ms : LATENCY_SATURATION_MS);
+	if(latency.count % LATENCY_REPORT_DECISIONS == 0){
+		char buf[80];
+		int buf_len = sprintf(buf, "Detection latency p50 %lu p90 %lu max %lu ms, %lu overruns\r\n",
+				latency_percentile(&latency, 50), latency_percentile(&latency, 90),
+				latency.max_ms, capture.overruns);
+		report(buf, buf_len);
+	}
+}
+#endif
+
+#ifdef SLEEP_UNTIL_WORK
+/**
+  * @brief Sleeps in WFI until an interrupt, unless an audio block or an inference is pending
+  * @param None
+  * @retval None
+  */
+void sleep_until_work(void){
+	// With interrupts masked a DMA callback between the check and WFI still ends the
+	// sleep, its handler runs once they are unmasked again
+	__disable_irq();
+#if defined(DEFERRED_FRONTEND) || defined(LOW_LATENCY_CAPTURE)
+	// The front-end runs in PendSV, or polls the DMA position every SysTick
+	bool frontend_in_loop = false;
+#else
+	bool frontend_in_loop = true;
+#endif
+	if(may_sleep(frame_queue_pending(&frame_queue), do_inference(&rb), frontend_in_loop)){
+#ifdef DUTY_CYCLE_REPORT
+		// The cycle counter stops with the core clock, SysTick keeps counting and
+		// wakes the core at least once per reload
+		uint32_t before = SysTick->VAL;
+		__DSB();
+		__WFI();
+		uint32_t after = SysTick->VAL;
+		duty_cycle_add_sleep(&duty_cycle, down_counter_elapsed(before, after, SysTick->LOAD + 1));
+#else
+		__DSB();
+		__WFI();
+#endif
+	}
+	__enable_irq();
+}
+#endif
+
+#ifdef STAGE_TRACE
+/**
+  * @brief Dumps the stage trace when a T was received on the USART. Recording stops
+  *        until the dump is out.
+  * @param None
+  * @retval None
+  */
+void service_stage_trace(void){
+#ifdef NONBLOCKING_UART
+	if(stage_trace.frozen){
+		if(uart_tx_block_done(&uart_tx)){
+			stage_trace_resume(&stage_trace);
+		}
+		return;
+	}
+	if(!uart_tx_block_done(&uart_tx)){
+		// A record of FEATURE_STREAM is on the wire, the request waits in RDR
+		return;
+	}
+#endif
+	if(!__HAL_USART_GET_FLAG(&husart1, USART_FLAG_RXNE)){
+		return;
+	}
+	uint8_t command = husart1.Instance->RDR & 0xFF;
+	__HAL_USART_CLEAR_OREFLAG(&husart1);
+	if(command != 'T'){
+		return;
+	}
+
+	uint16_t length;
+	const uint8_t* dump = stage_trace_freeze(&stage_trace, &length);
+#ifdef NONBLOCKING_UART
+	uart_tx_send_block(&uart_tx, dump, length);
+#else
+	report_blocking((const char*)dump, length);
+	stage_trace_resume(&stage_trace);
+#endif
+}
+#endif
+
+#ifdef DEFERRED_FRONTEND
+/**
+  * @brief PendSV handler hook, pended by the DMA callbacks
+  * @param None
+  * @retval None
+  */
+void PendSV_Callback(void){
+	process_audio();
+}
+#endif
 
 
 /* USER CODE END 0 */
@@ -177,15 +1160,15 @@ void normalize_mfccs(float32_t* mfccs_float, int8_t* mfccs_int8){
 int main(void)
 {
   /* USER CODE BEGIN 1 */
-	char buf[50];
-	int buf_len = 0;
 	TfLiteStatus tflite_status;
 	uint32_t num_elements;
 	uint32_t num_output_elements;
 	int8_t output[3];
-	const int kTensorArenaSize = 30 * 1024;
+	const int kTensorArenaSize = TENSOR_ARENA_SIZE; // Tests/arena_sizer.cpp
 	static uint8_t tensor_arena[kTensorArenaSize];
 	size_t counter = 0;
+	struct Detector detector;
+	const int8_t detector_thresholds[DETECTOR_CLASSES] = DETECTOR_THRESHOLDS;
 
   /* USER CODE END 1 */
 
@@ -211,15 +1194,49 @@ int main(void)
   MX_DFSDM1_Init();
   MX_USART1_Init();
   /* USER CODE BEGIN 2 */
+#ifdef MEMORY_WATERMARK
+	init_memory_watermark(&memory_watermark);
+#endif
+#ifdef NONBLOCKING_UART
+	init_uart_tx(&uart_tx, &husart1);
+#endif
+#ifdef FEATURE_STREAM
+	husart1.Init.BaudRate = FEATURE_STREAM_BAUDRATE;
+	if (HAL_USART_Init(&husart1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	init_feature_stream(&feature_stream, &uart_tx, FEATURE_STREAM_STAGES);
+#endif
+	init_frontend();
+	set_inference_cadence(&rb, INFERENCE_STRIDE, TRIGGER_REFRACTORY);
+	init_detector(&detector, DETECTOR_SMOOTHING, DETECTOR_LENGTH, detector_thresholds);
+#ifdef DEFERRED_FRONTEND
+	// Lowest priority, the DMA and SysTick interrupts preempt the front-end
+	HAL_NVIC_SetPriority(PendSV_IRQn, 15, 0);
+#endif
+	init_cycle_count();
+	init_frame_queue(&frame_queue);
+#ifdef STAGE_TRACE
+	// TIM2 runs at the APB1 timer clock, 80 MHz like the core
+	init_stage_trace(&stage_trace, SYSCLK);
+#endif
+#ifdef DUTY_CYCLE_REPORT
+	init_duty_cycle(&duty_cycle, DUTY_CYCLE_PERIOD_MS, SYSCLK / 1000, HAL_GetTick());
+#endif
 	if(HAL_OK != HAL_DFSDM_FilterRegularStart_DMA(&hdfsdm1_filter0, RecBuff, QUEUELENGTH)){
     Error_Handler();
   }
 
-	static tflite::MicroErrorReporter micro_error_reporter;
-	error_reporter = &micro_error_reporter;
+#ifdef TOKENIZED_LOG
+	static TokenErrorReporter token_error_reporter(report);
+	error_reporter = &token_error_reporter;
+#else
+	static TextErrorReporter text_error_reporter(report);
+	error_reporter = &text_error_reporter;
+#endif
 	// Say something to test error reporter
-	buf_len = sprintf(buf, "START TEST\r\n");
-	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+	log_event(LOG_START, 0);
 	error_reporter->Report("STM32 TensorFlow Lite test");
 	// Map the model into a usable data structure
 	model = tflite::GetModel(MFCC);
@@ -275,16 +1292,35 @@ int main(void)
 		while(1);
 	}
 
+#ifdef KERNEL_BENCHMARK
+	// The plain kernels, the arena holds one operator at a time until the interpreter takes it
+	kernel_bench_model(model, micro_op_resolver, tensor_arena, kTensorArenaSize, KERNEL_BENCH_ROUNDS,
+			error_reporter, report_kernel_bench);
+#endif
+
+#ifdef STREAMING_INFERENCE
+	static struct StreamingHead streaming_head;
+	static StreamingOpResolver streaming_op_resolver(micro_op_resolver, &streaming_head);
+	const tflite::MicroOpResolver& op_resolver = streaming_op_resolver;
+#else
+	const tflite::MicroOpResolver& op_resolver = micro_op_resolver;
+#endif
+#ifdef OP_PROFILER
+	static OpProfiler op_profiler;
+	static ProfilingOpResolver profiling_op_resolver(op_resolver, &op_profiler);
+	static tflite::MicroInterpreter static_interpreter(
+		model, profiling_op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
+#else
 	static tflite::MicroInterpreter static_interpreter(
-		model, micro_op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
+		model, op_resolver, tensor_arena, kTensorArenaSize, error_reporter);
+#endif
 	interpreter = &static_interpreter;
 
 	tflite_status = interpreter->AllocateTensors();
 
 	if (tflite_status != kTfLiteOk)
 	{
-		buf_len = sprintf(buf, "Failed tensors\r\n");
-		HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+		log_event(LOG_FAILED_TENSORS, 0);
 		error_reporter->Report("AllocateTensors() failed");
 		while(1);
 	}
@@ -292,13 +1328,27 @@ int main(void)
 	// Assign model input and output buffers (tensors) to pointers
 	model_input = interpreter->input(0);
 	model_output = interpreter->output(0);
-	float input_size = model_input->dims->size;
-	buf_len = sprintf(buf, "Model input size: %f\r\n", input_size);
-	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+	log_event(LOG_INPUT_SIZE, 1, model_input->dims->size);
+#ifdef OP_PROFILER
+	if(!profiling_op_resolver.attach(interpreter)){
+		error_reporter->Report("OP_PROFILER_NODES too small, later nodes run without profile");
+	}
+#endif
 	// Get number of elements in input tensor
 	num_elements = model_input->bytes;
-	buf_len = sprintf(buf, "Number of input elements: %lu\r\n", num_elements);
-	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+	log_event(LOG_INPUT_ELEMENTS, 1, num_elements);
+	log_event(LOG_ARENA, 2, (uint32_t)interpreter->arena_used_bytes(), (uint32_t)kTensorArenaSize);
+#ifdef STREAMING_INFERENCE
+	if(!init_streaming_head(&streaming_head, model, interpreter) || streaming_head.window_rows != BUFFERSIZE){
+		// Falls back to the full model
+		streaming_head.enabled = false;
+		log_event(LOG_NOT_STREAMABLE, 0);
+	}
+#endif
+
+#ifdef DCT_BENCHMARK
+	benchmark_dct2();
+#endif
 
 
 
@@ -308,34 +1358,9 @@ int main(void)
   /* USER CODE BEGIN WHILE */
 
 
-	// Parameters
-	const int sr = SAMPLINGRATE;
-	const int fl = QUEUELENGTH / 2; // frame length
-	const int n_mb = 64; // mel bins
-	const int n_mfccs = N_MFCCS;
-
-	// Buffer
-	float32_t buffer1[fl];
-	float32_t buffer2[fl];
-	struct RingBuffer rb;
-	// Output
-	float32_t mfccs_float[N_MFCCS];
-	int8_t mfccs_int8[N_MFCCS];
-
-	// Other Objects
-	arm_rfft_fast_instance_f32 rfft_struct_v1;
-	arm_rfft_fast_instance_f32 rfft_struct_v2;
-
-
-	// Initialize Objects
-	init_ring_buffer(&rb);
-	arm_status status_v1 = arm_rfft_fast_init_f32(&rfft_struct_v1, fl);
-	arm_status status_v2 = arm_rfft_fast_init_f32(&rfft_struct_v2, n_mb);
-
-
 	// Debug
-	bool flag = true;
 	bool print_output = true;
+	bool ring_buffer_reported = false;
 
 
   while (1)
@@ -343,72 +1368,169 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
-		if(firstHalfFull && flag){
-			for(int i=0;i<QUEUELENGTH/2;i++){
-				buffer1[i] = (float32_t)(RecBuff[i]>>8);
-//		  	buf_len = sprintf(buf, "%f\r\n", buffer1[i]);
-//		  	HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
-			}
-
-			arm_rfft_fast_f32(&rfft_struct_v1, buffer1, buffer2, 0);
-			arm_cmplx_mag_f32(buffer2, buffer1, fl / 2);
-			calc_log_mel_spectrogram(buffer1, buffer2);
-			ben_dct2_f32(buffer2, buffer1,  mfccs_float, &rfft_struct_v2);
-			normalize_mfccs(mfccs_float, mfccs_int8);
-			insert_data(&rb, mfccs_int8);
-
-			firstHalfFull = false;
-			//flag = false;
+#ifdef SLEEP_UNTIL_WORK
+		sleep_until_work();
+#endif
+#ifdef DUTY_CYCLE_REPORT
+		struct DutyCycleReport duty_report;
+		if(duty_cycle_period_finished(&duty_cycle, HAL_GetTick(), &duty_report)){
+			log_event(LOG_DUTY, 5, duty_report.active_permille / 10, duty_report.active_permille % 10,
+					(uint32_t)(duty_report.sleep_cycles / 1000), (uint32_t)(duty_report.total_cycles / 1000),
+					duty_report.wakeups);
 		}
-		if(secondHalfFull){
-			for(int i=QUEUELENGTH/2;i<QUEUELENGTH;i++){
-				buffer1[i - QUEUELENGTH/2] = (float32_t)(RecBuff[i]>>8);
-//				buf_len = sprintf(buf, "%f\r\n", buffer1[i - QUEUELENGTH/2]);
-//				HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
-			}
-
-			arm_rfft_fast_f32(&rfft_struct_v1, buffer1, buffer2, 0);
-			arm_cmplx_mag_f32(buffer2, buffer1, fl / 2);
-			calc_log_mel_spectrogram(buffer1, buffer2);
-			ben_dct2_f32(buffer2, buffer1,  mfccs_float, &rfft_struct_v2);
-			normalize_mfccs(mfccs_float, mfccs_int8);
-			insert_data(&rb, mfccs_int8);
-
-			secondHalfFull = false;
+#endif
+#ifndef DEFERRED_FRONTEND
+		process_audio();
+#ifdef MEMORY_WATERMARK
+		memory_watermark_stage(&memory_watermark, MEMORY_FRONTEND);
+#endif
+#endif
+		if(rb.filled && !ring_buffer_reported){
+			// Reported here, the front-end must not wait for the UART
+			log_event(LOG_RING_BUFFER_FILLED, 0);
+			ring_buffer_reported = true;
 		}
+#ifdef STAGE_TRACE
+		service_stage_trace();
+#endif
 
 		if(do_inference(&rb)){
+#ifdef TIMING_REPORT
+			// Includes the front-end if it preempts the inference
+			TimingScope inference_scope(timing_inference);
+#endif
+#ifdef STAGE_TRACE
+			stage_trace_record(&stage_trace, TRACE_INFERENCE, counter);
+#endif
+#ifdef VAD_GATE
+			if(vad_window_quiet(&vad, BUFFERSIZE)){
+				// The whole window is quiet, report class 2 without running the model
+				update_last_inference_head(&rb);
+				vad_count_inference(&vad, true);
+				detector_reset(&detector);
+				log_event(LOG_SILENCE, 3, counter,
+						vad.inferences_skipped, vad.inferences_skipped + vad.inferences_run);
+#ifdef STAGE_TRACE
+				stage_trace_record(&stage_trace, TRACE_DECISION, counter);
+#endif
+				counter++;
+				continue;
+			}
+			vad_count_inference(&vad, false);
+#endif
+#ifdef STAGING_BENCHMARK
+			benchmark_staging(&rb, model_input->data.int8);
+#endif
+#ifdef STREAMING_INFERENCE
+			uint32_t rows_inserted = copy_inference_batch(&rb, model_input->data.int8);
+#ifdef STAGE_TRACE
+			stage_trace_record(&stage_trace, TRACE_STAGING, counter);
+#endif
+#ifdef MEMORY_WATERMARK
+			memory_watermark_stage(&memory_watermark, MEMORY_STAGING);
+#endif
+#ifdef STREAMING_BENCHMARK
+			static int8_t streaming_batch[BUFFERSIZE * N_MFCC];
+			memcpy(streaming_batch, model_input->data.int8, BUFFERSIZE * N_MFCC);
+#endif
+			ResetTimer();
+			StartTimer();
+			streaming_head_update(&streaming_head, model_input->data.int8, rows_inserted);
+#else
+#ifdef LATENCY_HISTOGRAM
+			uint32_t rows_inserted = copy_inference_batch(&rb, model_input->data.int8);
+#else
 			copy_inference_batch(&rb, model_input->data.int8);
+#endif
+#ifdef STAGE_TRACE
+			stage_trace_record(&stage_trace, TRACE_STAGING, counter);
+#endif
+#ifdef MEMORY_WATERMARK
+			memory_watermark_stage(&memory_watermark, MEMORY_STAGING);
+#endif
 			ResetTimer();
 			StartTimer();
+#endif
 			tflite_status = interpreter->Invoke();
 			if(tflite_status != kTfLiteOk)
 			{
 				error_reporter->Report("Invoke failed");
 			}
 			StopTimer();
-			buf_len = sprintf(buf, "##### [%d]s\r\n", getCycles());
-			HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+#ifdef STAGE_TRACE
+			stage_trace_record(&stage_trace, TRACE_INVOKE, counter);
+#endif
+#ifdef MEMORY_WATERMARK
+			memory_watermark_stage(&memory_watermark, MEMORY_INVOKE);
+#endif
+			log_event(LOG_CYCLES, 1, getCycles());
+#ifdef TIMING_REPORT
+			timing_record(timing_invoke, getCycles());
+#endif
+#ifdef OP_PROFILER
+			uint32_t profiled_invokes = op_profiler.stats[0].count;
+			if(profiled_invokes > 0 && profiled_invokes % OP_PROFILE_REPORT_INVOKES == 0){
+				report_op_profile(&op_profiler);
+			}
+#endif
 			output[0] = model_output->data.int8[0];
 			output[1] = model_output->data.int8[1];
 			output[2] = model_output->data.int8[2];
+#ifdef STREAMING_BENCHMARK
+			benchmark_streaming(&streaming_head, streaming_batch, getCycles(), output);
+#endif
 			if(print_output){
-				buf_len = sprintf(buf, "Output %d: [%d, %d, %d]\r\n", counter, output[0], output[1], output[2]);
-				HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+				log_event(window_continuous(&rb) ? LOG_OUTPUT : LOG_OUTPUT_GAP, 4,
+						counter, output[0], output[1], output[2]);
 			}
 
-			if(output[1] > output[0] && output[1] > output[2]){
-				buf_len = sprintf(buf, "[%d] I am bit deaf, but did you say <<Hey Snips>>?!\r\n", counter);
-				HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
-				HAL_Delay(200);
+			int detection = detector_update(&detector, output);
+			if(detection == 1){
+				log_event(LOG_KEYWORD, 1, counter);
+				// No inference for TRIGGER_REFRACTORY rows instead of stalling the loop
 				set_triggered(&rb);
-			} else if(output[0] > output[1] && output[0] > output[2]){
-				buf_len = sprintf(buf, "[%d] Hearing noise I don't understand.\r\n", counter);
-				HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
-			} else if(output[2] > output[0] && output[2] > output[1]){
-				buf_len = sprintf(buf, "[%d] Hearing nothing.\r\n", counter);
-				HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
+				// The smoothed keyword score must not trigger again after the refractory rows
+				detector_reset(&detector);
+			} else if(detection == 0){
+				log_event(LOG_NOISE, 1, counter);
+			} else if(detection == 2){
+				log_event(LOG_NOTHING, 1, counter);
+			}
+#ifdef STAGE_TRACE
+			stage_trace_record(&stage_trace, TRACE_DECISION, counter);
+#endif
+#ifdef LATENCY_HISTOGRAM
+			record_detection_latency(rows_inserted);
+#endif
+
+			if(counter % STATUS_REPORT_INFERENCES == 0){
+#ifdef NONBLOCKING_UART
+				uint32_t messages_dropped = uart_tx.dropped;
+#else
+				uint32_t messages_dropped = 0;
+#endif
+#ifdef LOW_LATENCY_CAPTURE
+				log_event(LOG_STATUS_CAPTURE, 3, capture.overruns, capture.dropped, messages_dropped);
+#else
+				log_event(LOG_STATUS, 4, frame_queue.lost, frame_queue.late, frame_queue.overruns,
+						messages_dropped);
+#endif
+#ifdef FEATURE_STREAM
+				log_event(LOG_STREAM, 2, feature_stream.sent, feature_stream.dropped);
+#endif
+#ifdef TIMING_REPORT
+				report_timing();
+#endif
+#ifdef MEMORY_WATERMARK
+				log_event(LOG_MEMORY, 8, memory_watermark.stage_peak[MEMORY_FRONTEND],
+						memory_watermark.stage_peak[MEMORY_STAGING], memory_watermark.stage_peak[MEMORY_INVOKE],
+						memory_watermark.stage_peak[MEMORY_REPORTING], memory_watermark.stack_peak,
+						memory_watermark.heap_peak, memory_watermark.free_min, memory_watermark.heap_failures);
+#endif
 			}
+#ifdef MEMORY_WATERMARK
+			memory_watermark_stage(&memory_watermark, MEMORY_REPORTING);
+#endif
 
 			counter++;
 		}
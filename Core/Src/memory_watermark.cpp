@@ -0,0 +1,73 @@
+/*
+ * memory_watermark.cpp
+ *
+ *  Stack painting and heap tracking, see memory_watermark.h
+ */
+
+#include "memory_watermark.h"
+#include <stddef.h>
+#include "stm32l4xx_hal.h"
+
+// Linker script and sysmem.c
+extern "C" {
+extern uint32_t _estack;
+extern char* sbrk_peak;
+extern unsigned int sbrk_failures;
+}
+extern char end asm("end");
+
+static uint32_t* heap_top(void){
+	uintptr_t top = (uintptr_t)(sbrk_peak != nullptr ? sbrk_peak : &end);
+	return (uint32_t*)((top + 3) & ~(uintptr_t)3);
+}
+
+// Painting is inlined so that no frame of its own lies below this limit
+static uint32_t* paint_limit(void){
+	return (uint32_t*)((__get_MSP() - MEMORY_PAINT_GUARD) & ~(uint32_t)3);
+}
+
+void init_memory_watermark(struct MemoryWatermark* watermark){
+	for(int i = 0; i < MEMORY_STAGES; i++){
+		watermark->stage_peak[i] = 0;
+	}
+	watermark->stack_peak = 0;
+	watermark->heap_peak = 0;
+	watermark->free_min = UINT32_MAX;
+	watermark->heap_failures = 0;
+	watermark->painted = heap_top();
+
+	uint32_t* limit = paint_limit();
+	for(uint32_t* word = watermark->painted; word < limit; word++){
+		*word = MEMORY_PAINT;
+	}
+}
+
+void memory_watermark_stage(struct MemoryWatermark* watermark, enum MemoryStage stage){
+	uint32_t* heap = heap_top();
+	uint32_t* limit = paint_limit();
+
+	// The heap may have grown into the painted words
+	uint32_t* deepest = heap > watermark->painted ? heap : watermark->painted;
+	while(deepest < limit && *deepest == MEMORY_PAINT){
+		deepest++;
+	}
+
+	uint32_t depth = (uintptr_t)&_estack - (uintptr_t)deepest;
+	if(depth > watermark->stage_peak[stage]){
+		watermark->stage_peak[stage] = depth;
+	}
+	if(depth > watermark->stack_peak){
+		watermark->stack_peak = depth;
+	}
+	watermark->heap_peak = (uintptr_t)heap - (uintptr_t)&end;
+	uint32_t gap = (deepest > heap) ? (uintptr_t)deepest - (uintptr_t)heap : 0;
+	if(gap < watermark->free_min){
+		watermark->free_min = gap;
+	}
+	watermark->heap_failures = sbrk_failures;
+
+	// The next stage is measured from a clean pattern
+	for(uint32_t* word = deepest; word < limit; word++){
+		*word = MEMORY_PAINT;
+	}
+}
@@ -0,0 +1,127 @@
+/*
+ * mfcc_q31.cpp
+ *
+ *  Integer-only MFCC front-end, see mfcc_q31.h
+ */
+
+#include "mfcc_q31.h"
+#include "frontend_tables.h"
+
+// log2(1 + i/32) in Q16
+static const int32_t log2_lut_q16[33] = {
+	0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+	27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904,
+	47705, 49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534,
+	64047, 65536
+};
+
+arm_status init_mfcc_q31(struct MfccQ31* mfcc, uint32_t frame_length, q15_t pre_emphasis, const q15_t* window){
+	mfcc->frame_length = frame_length;
+	mfcc->log2_frame_length = 31 - __CLZ(frame_length);
+	mfcc->pre_emphasis = pre_emphasis;
+	mfcc->window = window;
+	return arm_rfft_init_q31(&mfcc->rfft, frame_length, 0, 1);
+}
+
+int16_t convert_samples_q31(const int32_t* samples, q31_t* frame, uint32_t frame_length,
+		q15_t pre_emphasis, const q15_t* window){
+	uint32_t max_abs = 0;
+	int32_t prev = samples[0] >> 8;
+	for(uint32_t i = 0; i < frame_length; i++){
+		int32_t x = samples[i] >> 8;
+		int32_t sample = x - (int32_t)(((int64_t)pre_emphasis * prev) >> 15);
+		uint32_t abs_sample = (sample < 0) ? -sample : sample;
+		if(abs_sample > max_abs){
+			max_abs = abs_sample;
+		}
+		frame[i] = sample;
+		prev = x;
+	}
+
+	// Keep the sign bit free, a silent frame stays all zeros. The window is
+	// at most one, so it is applied after the normalization.
+	int16_t shift = (max_abs == 0) ? 0 : __CLZ(max_abs) - 1;
+	if(window != NULL){
+		for(uint32_t i = 0; i < frame_length; i++){
+			q31_t sample = (q31_t)((uint32_t)frame[i] << shift);
+			frame[i] = (q31_t)(((int64_t)sample * window[i]) >> 15);
+		}
+	} else {
+		for(uint32_t i = 0; i < frame_length; i++){
+			frame[i] = (q31_t)((uint32_t)frame[i] << shift);
+		}
+	}
+
+	return shift;
+}
+
+int32_t log2_q16(uint64_t x){
+	uint32_t hi = (uint32_t)(x >> 32);
+	uint32_t norm; // x shifted such that its leading one is bit 31
+	int32_t msb;
+
+	if(hi != 0){
+		uint32_t lz = __CLZ(hi);
+		msb = 63 - lz;
+		norm = (uint32_t)(x >> (32 - lz));
+	} else {
+		uint32_t lz = __CLZ((uint32_t)x);
+		msb = 31 - lz;
+		norm = (uint32_t)x << lz;
+	}
+
+	// Linear interpolation in the table, the 5 bits after the leading one select the segment
+	uint32_t idx = (norm >> 26) & 0x1F;
+	int32_t frac = (norm >> 10) & 0xFFFF;
+	int32_t y0 = log2_lut_q16[idx];
+	int32_t y1 = log2_lut_q16[idx + 1];
+
+	return (msb << 16) + y0 + (((y1 - y0) * frac) >> 16);
+}
+
+void calc_log2_mel_spectrogram_q31(const q31_t* magnitude, int16_t exponent, int32_t* log2_mel_q16){
+	for(int band = 0; band < N_MEL_BANDS; band++){
+		const q31_t* mag = &magnitude[mel_bands[band].start_bin];
+		const q15_t* weight = &mel_weights_q15[mel_bands[band].weight_offset];
+		int64_t sum = 0;
+
+		for(int i = 0; i < mel_bands[band].num_bins; i++){
+			sum += (int64_t)mag[i] * weight[i];
+		}
+
+		if(sum > 0){
+			log2_mel_q16[band] = log2_q16((uint64_t)sum) - ((int32_t)exponent << 16);
+		} else {
+			log2_mel_q16[band] = LOG2_MEL_FLOOR_Q16;
+		}
+	}
+}
+
+void dct2_int8(const int32_t* log2_mel_q16, int8_t* mfccs_int8){
+	const q31_t* basis = dct2_basis_log2_int8_q28;
+
+	for(int k = 0; k < N_MFCC_COEFFS; k++){
+		int64_t acc = dct2_bias_int8_q44;
+		for(int n = 0; n < N_MEL_BANDS; n++){
+			acc += (int64_t)(*basis++) * log2_mel_q16[n];
+		}
+
+		// Truncate towards zero like the cast in normalize_mfccs, but saturate
+		int32_t val = (acc >= 0) ? (int32_t)(acc >> 44) : -(int32_t)((-acc) >> 44);
+		mfccs_int8[k] = (int8_t)__SSAT(val, 8);
+	}
+}
+
+void calc_mfccs_q31(struct MfccQ31* mfcc, const int32_t* samples, q31_t* pFrame, q31_t* pState, int8_t* mfccs_int8){
+	int16_t shift = convert_samples_q31(samples, pFrame, mfcc->frame_length, mfcc->pre_emphasis, mfcc->window);
+
+	// The q31 RFFT scales its output down by the frame length and uses pFrame as scratch
+	arm_rfft_q31(&mfcc->rfft, pFrame, pState);
+
+	// The magnitude is scaled down by another factor of 2 (2.30 format)
+	arm_cmplx_mag_q31(pState, pFrame, mfcc->frame_length / 2);
+
+	// mag = |FFT(frame)| * 2^(shift - log2(N) - 1) with frame in DFSDM units, the mel weights add 15 fractional bits
+	calc_log2_mel_spectrogram_q31(pFrame, shift + 14 - mfcc->log2_frame_length, pState);
+	dct2_int8(pState, mfccs_int8);
+}
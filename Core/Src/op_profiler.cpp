@@ -0,0 +1,194 @@
+/*
+ * op_profiler.cpp
+ *
+ *  Per-operator profile, see op_profiler.h
+ */
+
+#include "op_profiler.h"
+#include "timing_scope.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+typedef TfLiteStatus (*KernelInvoke)(TfLiteContext* context, TfLiteNode* node);
+
+// The kernel invoke is a plain function pointer, the wrapper finds the node here
+struct ProfiledNode {
+	const TfLiteIntArray* inputs; // Identifies the node passed to the invoke
+	int index;
+	KernelInvoke invoke;
+	const char* name;
+};
+
+static OpProfiler* active_profiler = nullptr;
+static struct ProfiledNode profiled_nodes[OP_PROFILER_NODES];
+static int profiled_node_count = 0;
+static KernelInvoke original_invokes[OP_PROFILER_OPS]; // Per wrapped registration
+
+static const char* op_name(const TfLiteRegistration* registration){
+	if(registration->builtin_code == tflite::BuiltinOperator_CUSTOM){
+		return registration->custom_name;
+	}
+	return tflite::EnumNameBuiltinOperator(tflite::BuiltinOperator(registration->builtin_code));
+}
+
+static TfLiteStatus profiled_invoke(int op, TfLiteContext* context, TfLiteNode* node){
+	for(int i = 0; i < profiled_node_count; i++){
+		if(profiled_nodes[i].inputs == node->inputs){
+			uint32_t handle = active_profiler->BeginEvent(profiled_nodes[i].name,
+					tflite::Profiler::EventType::OPERATOR_INVOKE_EVENT, profiled_nodes[i].index, 0);
+			TfLiteStatus status = profiled_nodes[i].invoke(context, node);
+			active_profiler->EndEvent(handle);
+			return status;
+		}
+	}
+	// Not mapped by ProfilingOpResolver::attach, e.g. beyond OP_PROFILER_NODES
+	return original_invokes[op](context, node);
+}
+
+// One invoke per wrapped registration, so an unmapped node still finds its kernel
+template<int op>
+static TfLiteStatus profiled_invoke_op(TfLiteContext* context, TfLiteNode* node){
+	return profiled_invoke(op, context, node);
+}
+
+static const KernelInvoke profiled_invokes[] = {
+	profiled_invoke_op<0>, profiled_invoke_op<1>, profiled_invoke_op<2>, profiled_invoke_op<3>,
+	profiled_invoke_op<4>, profiled_invoke_op<5>, profiled_invoke_op<6>, profiled_invoke_op<7>,
+};
+static_assert(sizeof(profiled_invokes) / sizeof(profiled_invokes[0]) == OP_PROFILER_OPS,
+		"One profiled_invoke_op per OP_PROFILER_OPS");
+
+OpProfiler::OpProfiler(){
+	Reset();
+}
+
+void OpProfiler::Reset(){
+	nodes = 0;
+	for(int i = 0; i < OP_PROFILER_NODES; i++){
+		stats[i].name = nullptr;
+		stats[i].count = 0;
+		stats[i].min = UINT32_MAX;
+		stats[i].max = 0;
+		stats[i].sum = 0;
+	}
+	for(int i = 0; i < OP_PROFILER_EVENTS; i++){
+		events[i].open = false;
+	}
+	written = 0;
+	dropped = 0;
+}
+
+uint32_t OpProfiler::BeginEvent(const char* tag, EventType event_type,
+		int64_t event_metadata1, int64_t event_metadata2){
+	uint32_t handle = written++;
+	struct OpProfileEvent* event = &events[handle % OP_PROFILER_EVENTS];
+	event->node = (event_type == EventType::OPERATOR_INVOKE_EVENT) ? event_metadata1 : -1;
+	event->open = true;
+	if(event->node >= 0 && event->node < OP_PROFILER_NODES && stats[event->node].name == nullptr){
+		stats[event->node].name = tag;
+	}
+	event->start = cycle_count();
+	return handle;
+}
+
+void OpProfiler::EndEvent(uint32_t event_handle){
+	uint32_t end = cycle_count();
+	struct OpProfileEvent* event = &events[event_handle % OP_PROFILER_EVENTS];
+	if(!event->open || written - event_handle > OP_PROFILER_EVENTS){
+		dropped++;
+		return;
+	}
+	event->end = end;
+	event->open = false;
+	record(event->node, nullptr, end - event->start);
+}
+
+void OpProfiler::AddEvent(const char* tag, EventType event_type, uint64_t start,
+		uint64_t end, int64_t event_metadata1, int64_t event_metadata2){
+	struct OpProfileEvent* event = &events[written++ % OP_PROFILER_EVENTS];
+	event->node = (event_type == EventType::OPERATOR_INVOKE_EVENT) ? event_metadata1 : -1;
+	event->start = start;
+	event->end = end;
+	event->open = false;
+	record(event->node, tag, end - start);
+}
+
+void OpProfiler::record(int node, const char* tag, uint32_t cycles){
+	if(node < 0){
+		return;
+	}
+	if(node >= OP_PROFILER_NODES){
+		dropped++;
+		return;
+	}
+	struct OpProfileStats* node_stats = &stats[node];
+	if(node_stats->name == nullptr){
+		node_stats->name = tag;
+	}
+	node_stats->count++;
+	node_stats->sum += cycles;
+	if(cycles < node_stats->min){
+		node_stats->min = cycles;
+	}
+	if(cycles > node_stats->max){
+		node_stats->max = cycles;
+	}
+	if(node >= nodes){
+		nodes = node + 1;
+	}
+}
+
+ProfilingOpResolver::ProfilingOpResolver(const tflite::MicroOpResolver& inner, OpProfiler* profiler)
+		: inner(inner), ops(0) {
+	active_profiler = profiler;
+	profiled_node_count = 0;
+}
+
+const TfLiteRegistration* ProfilingOpResolver::wrap(const TfLiteRegistration* registration) const {
+	if(registration == nullptr || registration->invoke == nullptr){
+		return registration;
+	}
+	for(int i = 0; i < ops; i++){
+		if(originals[i] == registration){
+			return &registrations[i];
+		}
+	}
+	if(ops == OP_PROFILER_OPS){
+		// Runs without profile
+		return registration;
+	}
+	originals[ops] = registration;
+	original_invokes[ops] = registration->invoke;
+	registrations[ops] = *registration;
+	registrations[ops].invoke = profiled_invokes[ops];
+	return &registrations[ops++];
+}
+
+const TfLiteRegistration* ProfilingOpResolver::FindOp(tflite::BuiltinOperator op) const {
+	return wrap(inner.FindOp(op));
+}
+
+const TfLiteRegistration* ProfilingOpResolver::FindOp(const char* op) const {
+	return wrap(inner.FindOp(op));
+}
+
+tflite::MicroOpResolver::BuiltinParseFunction ProfilingOpResolver::GetOpDataParser(tflite::BuiltinOperator op) const {
+	return inner.GetOpDataParser(op);
+}
+
+bool ProfilingOpResolver::attach(const tflite::MicroInterpreter* interpreter){
+	profiled_node_count = 0;
+	size_t operators = interpreter->operators_size();
+	for(size_t i = 0; i < operators && i < OP_PROFILER_NODES; i++){
+		const tflite::NodeAndRegistration node_and_registration = interpreter->node_and_registration(i);
+		for(int j = 0; j < ops; j++){
+			if(node_and_registration.registration == &registrations[j]){
+				struct ProfiledNode* node = &profiled_nodes[profiled_node_count++];
+				node->inputs = node_and_registration.node.inputs;
+				node->index = i;
+				node->invoke = originals[j]->invoke;
+				node->name = op_name(originals[j]);
+			}
+		}
+	}
+	return operators <= OP_PROFILER_NODES;
+}
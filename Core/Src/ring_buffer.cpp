@@ -6,11 +6,9 @@
  */
 
 #include "ring_buffer.h"
-#include <stdio.h>
+#include <string.h>
 #include "stm32l4xx_hal.h"
 
-extern USART_HandleTypeDef husart1;
-
 void set_triggered(struct RingBuffer* rb){
 	rb->triggered = true;
 }
@@ -18,15 +16,28 @@ void set_triggered(struct RingBuffer* rb){
 void init_ring_buffer(struct RingBuffer* rb){
 	rb->buffer_ptr = 0;
 	rb->last_inference_head = 0;
+	rb->rows_since_gap = 0;
+	rb->version = 0;
+	rb->inference_stride = INFERENCE_STRIDE_DEFAULT;
+	rb->refractory_rows = MIN_DIST;
 	rb->filled = false;
 	rb->triggered = false;
 }
 
+void set_inference_cadence(struct RingBuffer* rb, uint16_t stride, uint16_t refractory_rows){
+	rb->inference_stride = stride;
+	rb->refractory_rows = refractory_rows;
+}
+
 void insert_data(struct RingBuffer* rb, int8_t* data){
-	for(int i = 0; i < N_MFCC; i++){
-		rb->data[rb->buffer_ptr][i] = data[i];
+	memcpy(rb->data[rb->buffer_ptr], data, N_MFCC);
+	memcpy(rb->data[rb->buffer_ptr + BUFFERSIZE], data, N_MFCC);
+	if(rb->rows_since_gap < BUFFERSIZE){
+		rb->rows_since_gap++;
 	}
 	increment_buffer_ptr(rb);
+	__DMB();
+	rb->version++;
 }
 
 void increment_buffer_ptr(struct RingBuffer* rb){
@@ -35,11 +46,8 @@ void increment_buffer_ptr(struct RingBuffer* rb){
 	} else if(rb->buffer_ptr == BUFFERSIZE - 1){
 		rb->buffer_ptr = 0;
 		if(!rb->filled){
+			// Reported by the main loop, this can run in an interrupt
 			rb->filled = true;
-			int buf_len = 0;
-			char buf[50];
-			buf_len = sprintf(buf, "Ring Buffer initialized!");
-			HAL_USART_Transmit(&husart1, (uint8_t *)buf, buf_len, 100);
 		}
 	} else {
 		while(1){
@@ -48,15 +56,26 @@ void increment_buffer_ptr(struct RingBuffer* rb){
 	}
 }
 
-void copy_inference_batch(struct RingBuffer* rb, int8_t* batch){
+uint32_t copy_inference_batch(struct RingBuffer* rb, int8_t* batch){
+	uint32_t version;
+	uint16_t ptr;
 
-	for(int i = 0; i < BUFFERSIZE; i++){
-		for(int j = 0; j < N_MFCC; j++){
-			batch[i * N_MFCC + j] = rb->data[(i + rb->buffer_ptr) % BUFFERSIZE][j];
-		}
-	}
+	// insert_data can interrupt the copy if the front-end runs in an interrupt,
+	// copy again until no row was inserted in between
+	do {
+		version = rb->version;
+		__DMB();
+		ptr = rb->buffer_ptr;
+		memcpy(batch, rb->data[ptr], BUFFERSIZE * N_MFCC);
+		__DMB();
+	} while(version != rb->version);
 
-	update_last_inference_head(rb);
+	rb->last_inference_head = (ptr > 0) ? ptr - 1 : BUFFERSIZE - 1;
+	return version;
+}
+
+const int8_t* get_inference_window(struct RingBuffer* rb){
+	return rb->data[rb->buffer_ptr];
 }
 
 void update_last_inference_head(struct RingBuffer* rb){
@@ -71,6 +90,15 @@ void update_last_inference_head(struct RingBuffer* rb){
 	}
 }
 
+void mark_discontinuity(struct RingBuffer* rb){
+	// version stays monotonic, copy_inference_batch and the streaming row indices rely on it
+	rb->rows_since_gap = 0;
+}
+
+bool window_continuous(struct RingBuffer* rb){
+	return rb->rows_since_gap >= BUFFERSIZE;
+}
+
 int distance_buffer_ptr_last_inference_head(struct RingBuffer* rb){
 	if(rb->buffer_ptr >= rb->last_inference_head){
 		return rb->buffer_ptr - rb->last_inference_head;
@@ -85,12 +113,13 @@ int distance_buffer_ptr_last_inference_head(struct RingBuffer* rb){
 }
 
 bool do_inference(struct RingBuffer* rb){
-	int dist = distance_buffer_ptr_last_inference_head(rb);
+	// last_inference_head is the row before the window of the last inference
+	int rows = distance_buffer_ptr_last_inference_head(rb) - 1;
 	bool cond1 = rb->filled;
-	bool cond2 = distance_buffer_ptr_last_inference_head(rb) > 1;
-	bool cond3 = !rb->triggered || dist > MIN_DIST;
+	bool cond2 = rows >= rb->inference_stride;
+	bool cond3 = !rb->triggered || rows >= rb->refractory_rows;
 
-	if(rb->triggered && dist > MIN_DIST){
+	if(rb->triggered && rows >= rb->refractory_rows){
 		rb->triggered = false;
 	}
 
@@ -0,0 +1,61 @@
+/*
+ * stage_trace.cpp
+ *
+ *  Stage-level latency trace, see stage_trace.h
+ */
+
+#include "stage_trace.h"
+#include <stddef.h>
+#include "stm32l4xx_hal.h"
+
+void init_stage_trace(struct StageTrace* trace, uint32_t timer_hz){
+	trace->magic = STAGE_TRACE_MAGIC;
+	trace->written = 0;
+	trace->capacity = STAGE_TRACE_EVENTS;
+	trace->timer_hz = timer_hz;
+	trace->frozen = false;
+	trace->dropped = 0;
+	trace->frame = 0;
+
+	__HAL_RCC_TIM2_CLK_ENABLE();
+	TIM2->CR1 = 0;
+	TIM2->PSC = 0;
+	TIM2->ARR = 0xFFFFFFFF;
+	TIM2->EGR = TIM_EGR_UG;
+	TIM2->CR1 = TIM_CR1_CEN;
+}
+
+void stage_trace_record(struct StageTrace* trace, enum TraceStage stage, uint16_t id){
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if(trace->frozen){
+		trace->dropped++;
+	} else {
+		struct TraceEvent* event = &trace->events[trace->written % STAGE_TRACE_EVENTS];
+		event->timestamp = TIM2->CNT;
+		event->id = id;
+		event->stage = stage;
+		event->reserved = 0;
+		trace->written++;
+	}
+	__set_PRIMASK(primask);
+}
+
+void stage_trace_begin_frame(struct StageTrace* trace, uint16_t half){
+	trace->frame = half;
+	stage_trace_record(trace, TRACE_FRAME, half);
+}
+
+void stage_trace_frame_stage(struct StageTrace* trace, enum TraceStage stage){
+	stage_trace_record(trace, stage, trace->frame);
+}
+
+const uint8_t* stage_trace_freeze(struct StageTrace* trace, uint16_t* length){
+	trace->frozen = true;
+	*length = offsetof(struct StageTrace, events) + sizeof(trace->events);
+	return (const uint8_t*)trace;
+}
+
+void stage_trace_resume(struct StageTrace* trace){
+	trace->frozen = false;
+}
@@ -57,7 +57,7 @@ extern DMA_HandleTypeDef hdma_dfsdm1_flt0;
 /* USER CODE END ExternalFunctions */
 
 /* USER CODE BEGIN 0 */
-
+extern DMA_HandleTypeDef hdma_usart1_tx;
 /* USER CODE END 0 */
 /**
   * Initializes the Global MSP.
@@ -284,7 +284,29 @@ void HAL_USART_MspInit(USART_HandleTypeDef* husart)
     HAL_GPIO_Init(GPIOB, &GPIO_InitStruct);
 
   /* USER CODE BEGIN USART1_MspInit 1 */
+    /* USART1_TX on DMA2 channel 6, DMA1 channel 4 is taken by DFSDM1_FLT0 */
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    hdma_usart1_tx.Instance = DMA2_Channel6;
+    hdma_usart1_tx.Init.Request = DMA_REQUEST_2;
+    hdma_usart1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_usart1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_usart1_tx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_usart1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_usart1_tx.Init.Mode = DMA_NORMAL;
+    hdma_usart1_tx.Init.Priority = DMA_PRIORITY_LOW;
+    if (HAL_DMA_Init(&hdma_usart1_tx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(husart,hdmatx,hdma_usart1_tx);
 
+    /* Below the audio DMA, above the deferred front-end in PendSV */
+    HAL_NVIC_SetPriority(DMA2_Channel6_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Channel6_IRQn);
+    HAL_NVIC_SetPriority(USART1_IRQn, 5, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
   /* USER CODE END USART1_MspInit 1 */
   }
 
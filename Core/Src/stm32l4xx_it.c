@@ -59,7 +59,8 @@
 extern DMA_HandleTypeDef hdma_dfsdm1_flt0;
 extern DFSDM_Filter_HandleTypeDef hdfsdm1_filter0;
 /* USER CODE BEGIN EV */
-
+extern DMA_HandleTypeDef hdma_usart1_tx;
+extern USART_HandleTypeDef husart1;
 /* USER CODE END EV */
 
 /******************************************************************************/
@@ -170,6 +171,7 @@ void DebugMon_Handler(void)
 void PendSV_Handler(void)
 {
   /* USER CODE BEGIN PendSV_IRQn 0 */
+  PendSV_Callback();
 
   /* USER CODE END PendSV_IRQn 0 */
   /* USER CODE BEGIN PendSV_IRQn 1 */
@@ -227,6 +229,28 @@ void DFSDM1_FLT0_IRQHandler(void)
 }
 
 /* USER CODE BEGIN 1 */
+/**
+  * @brief This function handles DMA2 channel6 global interrupt, USART1_TX.
+  */
+void DMA2_Channel6_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart1_tx);
+}
+
+/**
+  * @brief This function handles USART1 global interrupt.
+  */
+void USART1_IRQHandler(void)
+{
+  HAL_USART_IRQHandler(&husart1);
+}
+
+/**
+  * @brief Deferred work pended by the application, overridden in main.cpp
+  */
+__weak void PendSV_Callback(void)
+{
+}
 
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,281 @@
+/*
+ * streaming_head.cpp
+ *
+ *  Streaming evaluation of the first two convolutions, see streaming_head.h
+ */
+
+#include "streaming_head.h"
+#include "tensorflow/lite/c/builtin_op_data.h"
+#include "tensorflow/lite/kernels/internal/common.h"
+#include "tensorflow/lite/kernels/internal/quantization_util.h"
+#include "tensorflow/lite/micro/kernels/kernel_util.h"
+
+// The kernel invoke is a plain function pointer, the shortcut finds its state here
+static struct StreamingHead* active_head = nullptr;
+static TfLiteStatus (*conv_invoke)(TfLiteContext* context, TfLiteNode* node) = nullptr;
+
+static const tflite::Tensor* model_tensor(const tflite::Model* model, int32_t index){
+	return model->subgraphs()->Get(0)->tensors()->Get(index);
+}
+
+static const void* model_tensor_data(const tflite::Model* model, int32_t index){
+	const tflite::Buffer* buffer = model->buffers()->Get(model_tensor(model, index)->buffer());
+	return (buffer->data() != nullptr) ? buffer->data()->data() : nullptr;
+}
+
+static bool read_conv(struct StreamConv* conv, const tflite::Model* model, const TfLiteNode* node,
+		uint16_t stride_height){
+	const TfLiteConvParams* params = (const TfLiteConvParams*)node->builtin_data;
+	if(node->inputs->size != 3 || params->padding != kTfLitePaddingSame || params->stride_height != stride_height
+			|| params->dilation_width_factor != 1 || params->dilation_height_factor != 1){
+		return false;
+	}
+
+	const tflite::Tensor* input = model_tensor(model, node->inputs->data[0]);
+	const tflite::Tensor* filter = model_tensor(model, node->inputs->data[1]);
+	const tflite::Tensor* output = model_tensor(model, node->outputs->data[0]);
+	if(input->type() != tflite::TensorType_INT8 || filter->type() != tflite::TensorType_INT8
+			|| output->type() != tflite::TensorType_INT8 || filter->shape()->Get(1) != 3
+			|| input->quantization() == nullptr || filter->quantization() == nullptr
+			|| output->quantization() == nullptr){
+		return false;
+	}
+
+	// NHWC, time is the height
+	conv->in_width = input->shape()->Get(2);
+	conv->in_channels = input->shape()->Get(3);
+	conv->out_width = output->shape()->Get(2);
+	conv->out_channels = output->shape()->Get(3);
+	conv->kernel_width = filter->shape()->Get(2);
+	conv->stride_width = params->stride_width;
+	uint32_t pad_width = (conv->out_width - 1) * conv->stride_width + conv->kernel_width;
+	conv->pad_left = (pad_width > conv->in_width) ? (pad_width - conv->in_width) / 2 : 0;
+	if(conv->out_channels > STREAM_CHANNELS_MAX || filter->quantization()->scale()->size() != conv->out_channels){
+		return false;
+	}
+
+	conv->filter = (const int8_t*)model_tensor_data(model, node->inputs->data[1]);
+	conv->bias = (const int32_t*)model_tensor_data(model, node->inputs->data[2]);
+	if(conv->filter == nullptr || conv->bias == nullptr){
+		return false;
+	}
+
+	float input_scale = input->quantization()->scale()->Get(0);
+	float output_scale = output->quantization()->scale()->Get(0);
+	conv->input_offset = -(int32_t)input->quantization()->zero_point()->Get(0);
+	conv->output_offset = (int32_t)output->quantization()->zero_point()->Get(0);
+	for(uint32_t c = 0; c < conv->out_channels; c++){
+		double scale = (double)input_scale * filter->quantization()->scale()->Get(c) / output_scale;
+		int shift;
+		tflite::QuantizeMultiplier(scale, &conv->multiplier[c], &shift);
+		conv->shift[c] = shift;
+	}
+
+	// Fused activation as in CalculateActivationRangeQuantized
+	if(params->activation != kTfLiteActNone && params->activation != kTfLiteActRelu
+			&& params->activation != kTfLiteActRelu6){
+		return false;
+	}
+	conv->activation_min = -128;
+	conv->activation_max = 127;
+	if(params->activation == kTfLiteActRelu || params->activation == kTfLiteActRelu6){
+		conv->activation_min = (conv->output_offset > -128) ? conv->output_offset : -128;
+	}
+	if(params->activation == kTfLiteActRelu6){
+		int32_t max = conv->output_offset + (int32_t)roundf(6.0f / output_scale);
+		conv->activation_max = (max < 127) ? max : 127;
+	}
+	conv->output_tensor = node->outputs->data[0];
+	return true;
+}
+
+// One output row from the three input rows under the kernel, NULL for padding.
+// Same arithmetic as reference_integer_ops::ConvPerChannel and arm_convolve_s8.
+static void conv_row(const struct StreamConv* conv, const int8_t* rows[3], int8_t* out){
+	for(uint32_t x = 0; x < conv->out_width; x++){
+		int32_t in_x0 = x * conv->stride_width - conv->pad_left;
+		for(uint32_t c = 0; c < conv->out_channels; c++){
+			const int8_t* filter = &conv->filter[c * 3 * conv->kernel_width * conv->in_channels];
+			int32_t acc = 0;
+			for(uint32_t ky = 0; ky < 3; ky++){
+				if(rows[ky] == NULL){
+					continue;
+				}
+				for(uint32_t kx = 0; kx < conv->kernel_width; kx++){
+					int32_t in_x = in_x0 + kx;
+					if(in_x < 0 || in_x >= conv->in_width){
+						continue;
+					}
+					const int8_t* in = &rows[ky][in_x * conv->in_channels];
+					const int8_t* w = &filter[(ky * conv->kernel_width + kx) * conv->in_channels];
+					for(uint32_t ic = 0; ic < conv->in_channels; ic++){
+						acc += w[ic] * (in[ic] + conv->input_offset);
+					}
+				}
+			}
+			acc += conv->bias[c];
+			acc = tflite::MultiplyByQuantizedMultiplier(acc, conv->multiplier[c], conv->shift[c]);
+			acc += conv->output_offset;
+			acc = (acc < conv->activation_min) ? conv->activation_min : acc;
+			acc = (acc > conv->activation_max) ? conv->activation_max : acc;
+			out[x * conv->out_channels + c] = (int8_t)acc;
+		}
+	}
+}
+
+bool init_streaming_head(struct StreamingHead* head, const tflite::Model* model, const tflite::MicroInterpreter* interpreter){
+	head->initialized = false;
+	head->enabled = false;
+	head->prepared = false;
+	head->rows1_end = 0;
+	head->rows2_end = 0;
+	head->window_start = 0;
+	head->rows_computed = 0;
+
+	if(interpreter->operators_size() < 3){
+		return false;
+	}
+	const TfLiteNode& node1 = interpreter->node_and_registration(0).node;
+	const TfLiteNode& node2 = interpreter->node_and_registration(1).node;
+	if(interpreter->node_and_registration(0).registration->builtin_code != tflite::BuiltinOperator_CONV_2D
+			|| interpreter->node_and_registration(1).registration->builtin_code != tflite::BuiltinOperator_CONV_2D
+			|| node1.inputs->data[0] != interpreter->inputs()[0]
+			|| node2.inputs->data[0] != node1.outputs->data[0]){
+		return false;
+	}
+
+	// First layer stride 1, second stride 2, both with one padded row on top
+	if(!read_conv(&head->conv[0], model, &node1, 1) || !read_conv(&head->conv[1], model, &node2, 2)){
+		return false;
+	}
+	head->window_rows = model_tensor(model, node1.inputs->data[0])->shape()->Get(1);
+	head->out_rows = model_tensor(model, node2.outputs->data[0])->shape()->Get(1);
+	if(head->window_rows > STREAM_HISTORY || (head->window_rows & 1) == 0 || head->out_rows != (head->window_rows + 1) / 2
+			|| head->conv[0].out_width * head->conv[0].out_channels > STREAM_ROW1_MAX
+			|| head->conv[1].out_width * head->conv[1].out_channels > STREAM_ROW2_MAX
+			|| head->conv[1].in_width != head->conv[0].out_width
+			|| head->conv[1].in_channels != head->conv[0].out_channels){
+		return false;
+	}
+
+	head->initialized = true;
+	head->enabled = true;
+	active_head = head;
+	return true;
+}
+
+void streaming_head_update(struct StreamingHead* head, const int8_t* window, uint32_t rows_inserted){
+	head->prepared = false;
+	if(!head->initialized || !head->enabled || rows_inserted < head->window_rows){
+		return;
+	}
+
+	const uint32_t n = head->window_rows;
+	const uint32_t row_size = head->conv[0].in_width * head->conv[0].in_channels;
+	const uint32_t s = rows_inserted - n;
+	const int8_t* rows[3];
+	head->rows_computed = 0;
+
+	// Interior rows of the first layer, centres s + 1 ... s + n - 2
+	if(head->rows1_end < s + 1 || head->rows1_end > s + n - 1){
+		head->rows1_end = s + 1;
+	}
+	for(; head->rows1_end < s + n - 1; head->rows1_end++){
+		const int8_t* centre = &window[(head->rows1_end - s) * row_size];
+		rows[0] = centre - row_size;
+		rows[1] = centre;
+		rows[2] = centre + row_size;
+		conv_row(&head->conv[0], rows, head->rows1[head->rows1_end % STREAM_HISTORY]);
+		head->rows_computed++;
+	}
+
+	// Interior rows of the second layer for both parities of the window start,
+	// centres s + 2 ... s + n - 3
+	if(head->rows2_end < s + 2 || head->rows2_end > s + n - 2){
+		head->rows2_end = s + 2;
+	}
+	for(; head->rows2_end < s + n - 2; head->rows2_end++){
+		uint32_t centre = head->rows2_end;
+		rows[0] = head->rows1[(centre - 1) % STREAM_HISTORY];
+		rows[1] = head->rows1[centre % STREAM_HISTORY];
+		rows[2] = head->rows1[(centre + 1) % STREAM_HISTORY];
+		conv_row(&head->conv[1], rows, head->rows2[centre % STREAM_HISTORY]);
+		head->rows_computed++;
+	}
+
+	// The edges see the SAME padding of the window
+	rows[0] = NULL;
+	rows[1] = &window[0];
+	rows[2] = &window[row_size];
+	conv_row(&head->conv[0], rows, head->edge1[0]);
+	rows[0] = &window[(n - 2) * row_size];
+	rows[1] = &window[(n - 1) * row_size];
+	rows[2] = NULL;
+	conv_row(&head->conv[0], rows, head->edge1[1]);
+
+	rows[0] = NULL;
+	rows[1] = head->edge1[0];
+	rows[2] = head->rows1[(s + 1) % STREAM_HISTORY];
+	conv_row(&head->conv[1], rows, head->edge2[0]);
+	rows[0] = head->rows1[(s + n - 2) % STREAM_HISTORY];
+	rows[1] = head->edge1[1];
+	rows[2] = NULL;
+	conv_row(&head->conv[1], rows, head->edge2[1]);
+	head->rows_computed += 4;
+
+	head->window_start = s;
+	head->prepared = true;
+}
+
+// Replaces the CONV_2D kernel. The first layer is skipped, its only consumer is
+// the second one, whose output is assembled from the cache.
+static TfLiteStatus streaming_conv_invoke(TfLiteContext* context, TfLiteNode* node){
+	struct StreamingHead* head = active_head;
+	if(head == nullptr || !head->enabled || !head->prepared){
+		return conv_invoke(context, node);
+	}
+
+	if(node->outputs->data[0] == head->conv[0].output_tensor){
+		return kTfLiteOk;
+	}
+	if(node->outputs->data[0] != head->conv[1].output_tensor){
+		return conv_invoke(context, node);
+	}
+
+	const uint32_t row_size = head->conv[1].out_width * head->conv[1].out_channels;
+	int8_t* output = tflite::micro::GetTensorData<int8_t>(tflite::micro::GetEvalOutput(context, node, 0));
+	memcpy(output, head->edge2[0], row_size);
+	for(uint32_t j = 1; j < head->out_rows - 1U; j++){
+		memcpy(&output[j * row_size], head->rows2[(head->window_start + 2 * j) % STREAM_HISTORY], row_size);
+	}
+	memcpy(&output[(head->out_rows - 1) * row_size], head->edge2[1], row_size);
+
+	head->prepared = false;
+	return kTfLiteOk;
+}
+
+StreamingOpResolver::StreamingOpResolver(const tflite::MicroOpResolver& inner, struct StreamingHead* head)
+		: inner(inner), conv_registration() {
+	const TfLiteRegistration* conv = inner.FindOp(tflite::BuiltinOperator_CONV_2D);
+	if(conv != nullptr){
+		conv_registration = *conv;
+		conv_invoke = conv->invoke;
+		conv_registration.invoke = streaming_conv_invoke;
+	}
+	head->initialized = false;
+}
+
+const TfLiteRegistration* StreamingOpResolver::FindOp(tflite::BuiltinOperator op) const {
+	if(op == tflite::BuiltinOperator_CONV_2D && conv_registration.invoke != nullptr){
+		return &conv_registration;
+	}
+	return inner.FindOp(op);
+}
+
+const TfLiteRegistration* StreamingOpResolver::FindOp(const char* op) const {
+	return inner.FindOp(op);
+}
+
+tflite::MicroOpResolver::BuiltinParseFunction StreamingOpResolver::GetOpDataParser(tflite::BuiltinOperator op) const {
+	return inner.GetOpDataParser(op);
+}
@@ -54,6 +54,10 @@
 extern int errno;
 register char * stack_ptr asm("sp");
 
+/* Highest heap end handed out and the refused requests, for memory_watermark.h */
+char *sbrk_peak = 0;
+unsigned int sbrk_failures = 0;
+
 /* Functions */
 
 /**
@@ -72,11 +76,14 @@ caddr_t _sbrk(int incr)
 	prev_heap_end = heap_end;
 	if (heap_end + incr > stack_ptr)
 	{
+		sbrk_failures++;
 		errno = ENOMEM;
 		return (caddr_t) -1;
 	}
 
 	heap_end += incr;
+	if (heap_end > sbrk_peak)
+		sbrk_peak = heap_end;
 
 	return (caddr_t) prev_heap_end;
 }
@@ -0,0 +1,122 @@
+/*
+ * timing_scope.cpp
+ *
+ *  Timing slots and the cycle counter of the target and the host, see timing_scope.h
+ */
+
+#include "timing_scope.h"
+#include <string.h>
+
+#ifdef __arm__
+#include "stm32l4xx_hal.h"
+#elif defined(TIMING_HOST_TSC)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+static struct TimingSlot slots[TIMING_SLOTS];
+static int slot_count = 0;
+
+#ifdef __arm__
+void init_cycle_count(void){
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t cycle_count(void){
+	return DWT->CYCCNT;
+}
+#else
+void init_cycle_count(void){
+}
+
+uint32_t cycle_count(void){
+#ifdef TIMING_HOST_TSC
+	return (uint32_t)__rdtsc();
+#else
+	return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+#endif
+
+static void clear_slot(struct TimingSlot* slot){
+	slot->count = 0;
+	slot->min = UINT32_MAX;
+	slot->max = 0;
+	slot->sum = 0;
+	for(int i = 0; i < TIMING_HISTOGRAM_BINS; i++){
+		slot->histogram[i] = 0;
+	}
+}
+
+int timing_slot(const char* name){
+	for(int i = 0; i < slot_count; i++){
+		if(strcmp(slots[i].name, name) == 0){
+			return i;
+		}
+	}
+	if(slot_count == TIMING_SLOTS){
+		return -1;
+	}
+	slots[slot_count].name = name;
+	clear_slot(&slots[slot_count]);
+	return slot_count++;
+}
+
+void timing_record(int slot, uint32_t cycles){
+	if(slot < 0 || slot >= slot_count){
+		return;
+	}
+#ifdef __arm__
+	// Scopes of the same slot may end in the main loop and in an interrupt
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+#endif
+	struct TimingSlot* timing = &slots[slot];
+	timing->count++;
+	timing->sum += cycles;
+	if(cycles < timing->min){
+		timing->min = cycles;
+	}
+	if(cycles > timing->max){
+		timing->max = cycles;
+	}
+	timing->histogram[(cycles == 0) ? 0 : 31 - __builtin_clz(cycles)]++;
+#ifdef __arm__
+	__set_PRIMASK(primask);
+#endif
+}
+
+const struct TimingSlot* timing_get_slot(int slot){
+	return (slot >= 0 && slot < slot_count) ? &slots[slot] : nullptr;
+}
+
+int timing_slot_count(void){
+	return slot_count;
+}
+
+uint32_t timing_percentile(int slot, uint32_t percent){
+	const struct TimingSlot* timing = timing_get_slot(slot);
+	if(timing == nullptr || timing->count == 0){
+		return 0;
+	}
+	uint32_t target = (uint32_t)(((uint64_t)timing->count * percent + 99) / 100);
+	uint32_t total = 0;
+	for(int i = 0; i < TIMING_HISTOGRAM_BINS; i++){
+		total += timing->histogram[i];
+		if(total >= target){
+			// The largest duration is a tighter bound for the last bin
+			uint32_t edge = (i == 31) ? UINT32_MAX : (2u << i) - 1;
+			return (edge < timing->max) ? edge : timing->max;
+		}
+	}
+	return timing->max;
+}
+
+void timing_reset(void){
+	for(int i = 0; i < slot_count; i++){
+		clear_slot(&slots[i]);
+	}
+}
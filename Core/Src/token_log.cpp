@@ -0,0 +1,116 @@
+/*
+ * token_log.cpp
+ *
+ *  Packing of tokenized log messages, see token_log.h
+ */
+
+#include "token_log.h"
+#include <stdio.h>
+#include <string.h>
+#include "stm32l4xx_hal.h"
+
+static void put_u32(uint8_t* data, uint32_t value){
+	data[0] = value & 0xFF;
+	data[1] = (value >> 8) & 0xFF;
+	data[2] = (value >> 16) & 0xFF;
+	data[3] = (value >> 24) & 0xFF;
+}
+
+// Fills in sync, length and checksum around length - 1 bytes after the token
+static int token_log_finish(uint8_t* packet, int length){
+	packet[0] = TOKEN_LOG_SYNC;
+	packet[1] = length;
+	uint8_t sum = 0;
+	for(int i = 1; i < length + 2; i++){
+		sum += packet[i];
+	}
+	packet[length + 2] = -sum;
+	return length + 3;
+}
+
+int token_log_vpack(uint8_t* packet, uint8_t token, uint32_t timestamp_ms, int n, va_list args){
+	if(n > TOKEN_LOG_MAX_ARGS){
+		n = TOKEN_LOG_MAX_ARGS;
+	}
+	packet[2] = token;
+	put_u32(&packet[3], timestamp_ms);
+	for(int i = 0; i < n; i++){
+		put_u32(&packet[7 + 4 * i], (uint32_t)va_arg(args, int32_t));
+	}
+	return token_log_finish(packet, 5 + 4 * n);
+}
+
+int token_log_pack_format(uint8_t* packet, uint32_t timestamp_ms, const char* format, va_list args){
+	packet[2] = TOKEN_LOG_FORMAT;
+	put_u32(&packet[3], timestamp_ms);
+	put_u32(&packet[7], (uint32_t)(uintptr_t)format);
+	int n = 0;
+
+	// Only as much of printf as is needed to step through the arguments
+	const char* c = format;
+	while(*c != '\0' && n < TOKEN_LOG_MAX_ARGS){
+		if(*c++ != '%'){
+			continue;
+		}
+		if(*c == '%'){
+			c++;
+			continue;
+		}
+		while(*c != '\0' && strchr("-+ #0", *c) != NULL){
+			c++;
+		}
+		// A * width or precision is an int argument of its own
+		while(*c != '\0' && strchr("0123456789.*", *c) != NULL && n < TOKEN_LOG_MAX_ARGS){
+			if(*c == '*'){
+				put_u32(&packet[11 + 4 * n++], (uint32_t)va_arg(args, int));
+			}
+			c++;
+		}
+		int longs = 0;
+		while(*c != '\0' && strchr("hlLzjt", *c) != NULL){
+			longs += (*c == 'l');
+			c++;
+		}
+		if(*c == '\0' || n >= TOKEN_LOG_MAX_ARGS){
+			break;
+		}
+		uint32_t value;
+		if(strchr("fFeEgGaA", *c) != NULL){
+			float f = (float)va_arg(args, double);
+			memcpy(&value, &f, sizeof(value));
+		} else if(*c == 's' || *c == 'p'){
+			value = (uint32_t)(uintptr_t)va_arg(args, void*);
+		} else if(longs >= 2){
+			value = (uint32_t)va_arg(args, long long);
+		} else if(longs == 1){
+			value = (uint32_t)va_arg(args, long);
+		} else {
+			value = (uint32_t)va_arg(args, int);
+		}
+		put_u32(&packet[11 + 4 * n++], value);
+		c++;
+	}
+	return token_log_finish(packet, 9 + 4 * n);
+}
+
+int TokenErrorReporter::Report(const char* format, va_list args){
+	uint8_t packet[TOKEN_LOG_PACKET_MAX];
+	int length = token_log_pack_format(packet, HAL_GetTick(), format, args);
+	write_((const char*)packet, length);
+	return length;
+}
+
+int TextErrorReporter::Report(const char* format, va_list args){
+	char text[128];
+	int length = vsnprintf(text, sizeof(text) - 2, format, args);
+	if(length < 0){
+		return length;
+	}
+	if(length > (int)sizeof(text) - 3){
+		length = sizeof(text) - 3;
+	}
+	text[length++] = '\r';
+	text[length++] = '\n';
+	write_(text, length);
+	return length;
+}
@@ -0,0 +1,133 @@
+/*
+ * uart_tx.cpp
+ *
+ *  Queued DMA transmission, see uart_tx.h
+ */
+
+#include "uart_tx.h"
+#include <stdio.h>
+#include <string.h>
+
+// Starts the oldest waiting message, called with interrupts masked or from the USART interrupt
+static void uart_tx_start(struct UartTx* tx){
+	if(tx->busy){
+		return;
+	}
+	if(tx->block != NULL){
+		const uint8_t* block = tx->block;
+		tx->block = NULL;
+		tx->busy = true;
+		tx->block_busy = true;
+		if(HAL_USART_Transmit_DMA(tx->husart, (uint8_t *)block, tx->block_length) != HAL_OK){
+			tx->busy = false;
+			tx->block_busy = false;
+			tx->dropped++;
+		}
+		return;
+	}
+	if(tx->head == tx->tail){
+		return;
+	}
+
+	struct UartTxSlot* slot = &tx->slots[tx->tail % UART_TX_SLOTS];
+	memcpy(tx->dma_buffer, slot->data, slot->length);
+	uint16_t length = slot->length;
+	tx->tail++;
+
+	tx->busy = true;
+	if(HAL_USART_Transmit_DMA(tx->husart, (uint8_t *)tx->dma_buffer, length) != HAL_OK){
+		// A blocking transmit owns the USART, the next write tries again
+		tx->busy = false;
+		tx->dropped++;
+	}
+}
+
+// Claims the slot for the next message, dropping the oldest one if the queue is full
+static struct UartTxSlot* uart_tx_claim(struct UartTx* tx, bool* dropped){
+	*dropped = false;
+	if(tx->head - tx->tail == UART_TX_SLOTS){
+		tx->tail++;
+		tx->dropped++;
+		*dropped = true;
+	}
+	return &tx->slots[tx->head % UART_TX_SLOTS];
+}
+
+void init_uart_tx(struct UartTx* tx, USART_HandleTypeDef* husart){
+	tx->husart = husart;
+	tx->head = 0;
+	tx->tail = 0;
+	tx->busy = false;
+	tx->sent = 0;
+	tx->dropped = 0;
+	tx->truncated = 0;
+	tx->block = NULL;
+	tx->block_length = 0;
+	tx->block_busy = false;
+}
+
+bool uart_tx_write(struct UartTx* tx, const char* text, uint16_t length){
+	bool dropped;
+	if(length > UART_TX_SLOT_SIZE){
+		length = UART_TX_SLOT_SIZE;
+		tx->truncated++;
+	}
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	struct UartTxSlot* slot = uart_tx_claim(tx, &dropped);
+	memcpy(slot->data, text, length);
+	slot->length = length;
+	tx->head++;
+	uart_tx_start(tx);
+	__set_PRIMASK(primask);
+	return !dropped;
+}
+
+bool uart_tx_event(struct UartTx* tx, uint32_t timestamp_ms, const char* text, uint16_t length){
+	char line[UART_TX_SLOT_SIZE];
+	int prefix = snprintf(line, UART_TX_SLOT_SIZE, "%lu ", timestamp_ms);
+	if(prefix + length > UART_TX_SLOT_SIZE){
+		length = UART_TX_SLOT_SIZE - prefix;
+		tx->truncated++;
+	}
+	memcpy(&line[prefix], text, length);
+	return uart_tx_write(tx, line, prefix + length);
+}
+
+bool uart_tx_send_block(struct UartTx* tx, const uint8_t* data, uint16_t length){
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+	if(!uart_tx_block_done(tx)){
+		__set_PRIMASK(primask);
+		return false;
+	}
+	tx->block = data;
+	tx->block_length = length;
+	uart_tx_start(tx);
+	__set_PRIMASK(primask);
+	return true;
+}
+
+bool uart_tx_block_done(const struct UartTx* tx){
+	return tx->block == NULL && !tx->block_busy;
+}
+
+void uart_tx_flush(struct UartTx* tx){
+	while(tx->busy || tx->head != tx->tail || tx->block != NULL){
+		if(!tx->busy){
+			// Restart after a transfer that could not be started
+			uint32_t primask = __get_PRIMASK();
+			__disable_irq();
+			uart_tx_start(tx);
+			__set_PRIMASK(primask);
+		}
+	}
+}
+
+void uart_tx_complete(struct UartTx* tx){
+	tx->busy = false;
+	tx->block_busy = false;
+	tx->sent++;
+	uart_tx_start(tx);
+}
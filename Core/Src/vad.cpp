@@ -0,0 +1,53 @@
+/*
+ * vad.cpp
+ *
+ *  Energy based voice activity detection, see vad.h
+ */
+
+#include "vad.h"
+
+void init_vad(struct Vad* vad, int8_t threshold_on, int8_t threshold_off, uint16_t hangover_rows){
+	vad->threshold_on = threshold_on;
+	vad->threshold_off = threshold_off;
+	vad->hangover_rows = hangover_rows;
+	vad->hangover = 0;
+	vad->quiet_rows = 0;
+	vad->active = false;
+	vad->inferences_run = 0;
+	vad->inferences_skipped = 0;
+}
+
+bool vad_update(struct Vad* vad, const int8_t* mfccs_int8){
+	int8_t energy = mfccs_int8[0];
+
+	if(energy > vad->threshold_on){
+		vad->active = true;
+		vad->hangover = vad->hangover_rows;
+	} else if(vad->active && energy < vad->threshold_off){
+		if(vad->hangover > 0){
+			vad->hangover--;
+		} else {
+			vad->active = false;
+		}
+	}
+
+	if(vad->active){
+		vad->quiet_rows = 0;
+	} else if(vad->quiet_rows < UINT16_MAX){
+		vad->quiet_rows++;
+	}
+
+	return vad->active;
+}
+
+bool vad_window_quiet(struct Vad* vad, uint16_t window_rows){
+	return vad->quiet_rows >= window_rows;
+}
+
+void vad_count_inference(struct Vad* vad, bool skipped){
+	if(skipped){
+		vad->inferences_skipped++;
+	} else {
+		vad->inferences_run++;
+	}
+}
@@ -0,0 +1,134 @@
+import math
+import re
+
+# Generates Core/Src/frontend_tables.cpp, the const (flash resident) tables used
+# by the feature front-end. The mel weights are taken from the table produced by
+# calc_linear_to_mel_weight_list.py, so that script has to be re-run first if
+# the sampling rate, band edges or the number of mel bins change.
+
+MEL_LIST = 'linear_to_mel_weight_list.h'
+OUTPUT = 'frontend_tables.cpp'
+
+FRAME_LENGTH = 1024
+NUM_MEL_BINS = 64
+NUM_MFCC = 13
+
+# Quantization parameters of the model input (see INPUT_SCALE and
+# INPUT_ZERO_POINT in main.cpp)
+INPUT_SCALE = 0.003135847859084606
+INPUT_ZERO_POINT = -128
+MFCC_DIVISOR = 512
+
+DCT_Q28_SHIFT = 28
+
+
+def read_mel_list(file_name):
+    with open(file_name) as file:
+        content = file.read()
+    body = content[content.index('{', content.index('[]')) + 1:content.index('};')]
+    values = [float(v) for v in re.findall(r'[-0-9.e]+', body)]
+
+    bands = []
+    weights = []
+    i = 0
+    while i < len(values):
+        num_bins = int(values[i])
+        idx = [int(values[i + 1 + 2 * k]) for k in range(num_bins)]
+        assert idx == list(range(idx[0], idx[0] + num_bins)), 'mel band is not contiguous'
+        bands.append((idx[0], num_bins, len(weights)))
+        weights += [values[i + 2 + 2 * k] for k in range(num_bins)]
+        i += 1 + 2 * num_bins
+
+    assert len(bands) == NUM_MEL_BINS
+    return bands, weights
+
+
+def to_q15(val):
+    return max(-32768, min(32767, int(round(val * 32768))))
+
+
+def dct2_coefficient(k, n):
+    # DCT-II scaled by sqrt(2/N) as computed by ben_dct2_f32 and tf.signal.mfccs_from_log_mel_spectrograms
+    return math.sqrt(2.0 / NUM_MEL_BINS) * math.cos(math.pi * k * (2 * n + 1) / (2 * NUM_MEL_BINS))
+
+
+def format_list(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('\t' + ', '.join(fmt(v) for v in values[i:i + per_line]) + ',')
+    lines[-1] = lines[-1][:-1]
+    return '\n'.join(lines)
+
+
+def main():
+    bands, weights = read_mel_list(MEL_LIST)
+
+    c_str = '// Generated by Precalculations/calc_frontend_tables.py, do not edit.\n\n'
+    c_str += '#include "frontend_tables.h"\n\n'
+
+    c_str += 'const struct MelBand mel_bands[N_MEL_BANDS] = {\n'
+    c_str += format_list(bands, lambda b: '{{{}, {}, {}}}'.format(*b), 4)
+    c_str += '\n};\n\n'
+
+    c_str += 'const float32_t mel_weights_f32[N_MEL_WEIGHTS] = {\n'
+    c_str += format_list(weights, lambda w: '{:.6f}f'.format(w), 10)
+    c_str += '\n};\n\n'
+
+    c_str += 'const q15_t mel_weights_q15[N_MEL_WEIGHTS] = {\n'
+    c_str += format_list([to_q15(w) for w in weights], str, 12)
+    c_str += '\n};\n\n'
+
+    # The power spectrum path computes 0.5 * ln(sum w * |X|^2). Adding 0.5 * ln(sum w)
+    # makes it equal to ln(sum w * |X|) when |X| is flat within the band.
+    offsets = [0.5 * math.log(sum(weights[b[2]:b[2] + b[1]])) for b in bands]
+    c_str += 'const float32_t mel_power_offset_f32[N_MEL_BANDS] = {\n'
+    c_str += format_list(offsets, lambda v: '{:.9e}f'.format(v), 8)
+    c_str += '\n};\n\n'
+
+    # Periodic Hann window, the default window of tf.signal.stft used in training
+    window = [0.5 - 0.5 * math.cos(2 * math.pi * n / FRAME_LENGTH) for n in range(FRAME_LENGTH)]
+    c_str += 'const float32_t hann_window_f32[WINDOW_LENGTH] = {\n'
+    c_str += format_list(window, lambda v: '{:.9e}f'.format(v), 8)
+    c_str += '\n};\n\n'
+
+    c_str += 'const q15_t hann_window_q15[WINDOW_LENGTH] = {\n'
+    c_str += format_list([to_q15(v) for v in window], str, 12)
+    c_str += '\n};\n\n'
+
+    # Truncated DCT: only the first NUM_MFCC coefficients, sqrt(2/N) included
+    basis = []
+    for k in range(NUM_MFCC):
+        basis += [dct2_coefficient(k, n) for n in range(NUM_MEL_BINS)]
+    c_str += 'const float32_t dct2_basis_f32[N_MFCC_COEFFS * N_MEL_BANDS] = {\n'
+    c_str += format_list(basis, lambda v: '{:.9e}f'.format(v), 8)
+    c_str += '\n};\n\n'
+
+    # Same with the int8 quantization of normalize_mfccs folded in
+    scale = 1.0 / (MFCC_DIVISOR * INPUT_SCALE)
+    c_str += 'const float32_t dct2_basis_int8_f32[N_MFCC_COEFFS * N_MEL_BANDS] = {\n'
+    c_str += format_list([v * scale for v in basis], lambda v: '{:.9e}f'.format(v), 8)
+    c_str += '\n};\n\n'
+    c_str += 'const float32_t dct2_bias_int8_f32 = {:.9e}f;\n\n'.format(0.5 / INPUT_SCALE + INPUT_ZERO_POINT)
+
+    # Fixed-point DCT: the input is log2 of the mel energies, the output is the
+    # int8 model input. ln(2), the DCT scale and the int8 quantization of
+    # normalize_mfccs are folded into the coefficients.
+    scale = math.log(2.0) / (MFCC_DIVISOR * INPUT_SCALE)
+    basis = []
+    for k in range(NUM_MFCC):
+        basis += [int(round(dct2_coefficient(k, n) * scale * 2 ** DCT_Q28_SHIFT)) for n in range(NUM_MEL_BINS)]
+    c_str += 'const q31_t dct2_basis_log2_int8_q28[N_MFCC_COEFFS * N_MEL_BANDS] = {\n'
+    c_str += format_list(basis, str, 8)
+    c_str += '\n};\n\n'
+
+    bias = 0.5 / INPUT_SCALE + INPUT_ZERO_POINT
+    c_str += 'const int64_t dct2_bias_int8_q44 = {}LL;\n'.format(int(round(bias * 2 ** (DCT_Q28_SHIFT + 16))))
+
+    with open(OUTPUT, 'w') as file:
+        file.write(c_str)
+
+    print("Done")
+
+
+if __name__ == '__main__':
+    main()
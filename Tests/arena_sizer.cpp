@@ -0,0 +1,235 @@
+/*
+ * arena_sizer.cpp
+ *
+ *  Sizes the tensor arena of the firmware. Loads the model of MFCC21.h with
+ *  the same kernels as main.cpp into a RecordingMicroInterpreter, prints what
+ *  the arena holds after AllocateTensors() and writes the minimum plus a
+ *  safety margin to Core/Inc/tensor_arena_size.h, which main.cpp uses for
+ *  kTensorArenaSize. Rerun it whenever the model or the kernels change.
+ *
+ *  The arena also holds structs of TFLite, which are larger with 64 bit
+ *  pointers. Build with -m32 to size them as on the target, a 64 bit build
+ *  gives an upper bound. TFLite is built as for the firmware, without
+ *  TF_LITE_STATIC_MEMORY, and cmsis_host_dsp.h lets the CMSIS-NN kernels take
+ *  their DSP paths, which request larger scratch buffers than the plain C
+ *  ones. The C sources first:
+ */
+
+// T=../TFLite; D=$T/tensorflow/lite/micro/tools/make/downloads; N=$D/cmsis/CMSIS
+// I="-I$T -I$D -I$N/NN/Include -I$N/DSP/Include -I$N/Core/Include -I../Drivers/CMSIS/Include"
+// gcc -m32 -c -O1 -DARM_MATH_DSP -include cmsis_host_dsp.h $I $(find $N/NN/Source -name '*.c') $T/tensorflow/lite/c/common.c
+// M=$T/tensorflow/lite/micro; S="$(ls $M/*.cc | grep -v test) $M/kernels/*.cc $M/kernels/cmsis-nn/*.cc"
+// S="$S $M/memory_planner/*.cc $T/tensorflow/lite/core/api/*.cc $T/tensorflow/lite/schema/schema_utils.cc"
+// S="$S $T/tensorflow/lite/kernels/kernel_util.cc $T/tensorflow/lite/kernels/internal/quantization_util.cc"
+// X="-I../Core/Inc -I$T/third_party/flatbuffers/include -I$T/third_party/gemmlowp -I$T/third_party/ruy"
+// g++ -m32 -O1 -DARM_MATH_DSP -include cmsis_host_dsp.h $I $X -o arena_sizer arena_sizer.cpp *.o $S
+// ./arena_sizer [header] [margin percent]
+
+#include <cstdio>
+#include <cstdlib>
+#include "MFCC21.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "tensorflow/lite/micro/recording_micro_interpreter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+#include "tensorflow/lite/version.h"
+
+#define HEADER "../Core/Inc/tensor_arena_size.h"
+#define MARGIN_PERCENT 10
+#define MARGIN_MIN 1024     // Bytes, at least
+#define ARENA_ALIGNMENT 256 // The size is rounded up to this
+#define PROBE_ARENA_SIZE (1024 * 1024)
+#define SCRATCH_OPS 8       // Distinct kernels ScratchRecordingOpResolver can wrap
+
+typedef TfLiteStatus (*KernelPrepare)(TfLiteContext* context, TfLiteNode* node);
+typedef TfLiteStatus (*ScratchRequest)(TfLiteContext* context, size_t bytes, int* buffer_idx);
+
+// Debug log of TFLite, cortex_m_generic/debug_log.cc on the target
+extern "C" void DebugLog(const char* s){
+	fputs(s, stderr);
+}
+
+// RecordingMicroAllocator does not record the scratch buffers the kernels
+// request in their prepare, they are counted here
+static ScratchRequest request_scratch = nullptr;
+static size_t scratch_bytes = 0;
+static int scratch_buffers = 0;
+
+static TfLiteStatus recording_request(TfLiteContext* context, size_t bytes, int* buffer_idx){
+	scratch_bytes += bytes;
+	scratch_buffers++;
+	return request_scratch(context, bytes, buffer_idx);
+}
+
+static KernelPrepare original_prepares[SCRATCH_OPS];
+
+// One trampoline per wrapped kernel, the prepare is a plain function pointer
+template<int I>
+static TfLiteStatus recording_prepare(TfLiteContext* context, TfLiteNode* node){
+	request_scratch = context->RequestScratchBufferInArena;
+	context->RequestScratchBufferInArena = recording_request;
+	TfLiteStatus status = original_prepares[I](context, node);
+	context->RequestScratchBufferInArena = request_scratch;
+	return status;
+}
+
+static const KernelPrepare recording_prepares[SCRATCH_OPS] = {
+	recording_prepare<0>, recording_prepare<1>, recording_prepare<2>, recording_prepare<3>,
+	recording_prepare<4>, recording_prepare<5>, recording_prepare<6>, recording_prepare<7>,
+};
+
+// Resolver that hands out the kernels of inner with their prepare counting
+// the scratch buffer requests
+class ScratchRecordingOpResolver : public tflite::MicroOpResolver {
+public:
+	explicit ScratchRecordingOpResolver(const tflite::MicroOpResolver& inner) : inner(inner), ops(0) {}
+
+	const TfLiteRegistration* FindOp(tflite::BuiltinOperator op) const override {
+		return wrap(inner.FindOp(op));
+	}
+	const TfLiteRegistration* FindOp(const char* op) const override {
+		return wrap(inner.FindOp(op));
+	}
+	BuiltinParseFunction GetOpDataParser(tflite::BuiltinOperator op) const override {
+		return inner.GetOpDataParser(op);
+	}
+
+private:
+	const TfLiteRegistration* wrap(const TfLiteRegistration* registration) const {
+		if(registration == nullptr || registration->prepare == nullptr){
+			return registration;
+		}
+		for(int i = 0; i < ops; i++){
+			if(originals[i] == registration){
+				return &registrations[i];
+			}
+		}
+		if(ops == SCRATCH_OPS){
+			fprintf(stderr, "SCRATCH_OPS too small, scratch buffers are not counted completely\n");
+			return registration;
+		}
+		originals[ops] = registration;
+		original_prepares[ops] = registration->prepare;
+		registrations[ops] = *registration;
+		registrations[ops].prepare = recording_prepares[ops];
+		return &registrations[ops++];
+	}
+
+	const tflite::MicroOpResolver& inner;
+	mutable TfLiteRegistration registrations[SCRATCH_OPS];
+	mutable const TfLiteRegistration* originals[SCRATCH_OPS];
+	mutable int ops;
+};
+
+static size_t print_allocation(const tflite::RecordingMicroAllocator& allocator,
+		tflite::RecordedAllocationType type, const char* name){
+	tflite::RecordedAllocation allocation = allocator.GetRecordedAllocation(type);
+	printf("  %-32s %8zu bytes %6zu requested %5zu items\n",
+			name, allocation.used_bytes, allocation.requested_bytes, allocation.count);
+	return allocation.used_bytes;
+}
+
+int main(int argc, char** argv){
+	const char* header_path = argc > 1 ? argv[1] : HEADER;
+	int margin_percent = argc > 2 ? atoi(argv[2]) : MARGIN_PERCENT;
+
+	static tflite::MicroErrorReporter micro_error_reporter;
+	tflite::ErrorReporter* error_reporter = &micro_error_reporter;
+
+	const tflite::Model* model = tflite::GetModel(MFCC);
+	if(model->version() != TFLITE_SCHEMA_VERSION){
+		fprintf(stderr, "Model version does not match Schema\n");
+		return 1;
+	}
+
+	// Same kernels as main.cpp
+	tflite::MicroMutableOpResolver<7> micro_op_resolver;
+	if(micro_op_resolver.AddFullyConnected() != kTfLiteOk ||
+			micro_op_resolver.AddConv2D() != kTfLiteOk ||
+			micro_op_resolver.AddMaxPool2D() != kTfLiteOk ||
+			micro_op_resolver.AddMean() != kTfLiteOk ||
+			micro_op_resolver.AddReshape() != kTfLiteOk ||
+			micro_op_resolver.AddSoftmax() != kTfLiteOk ||
+			micro_op_resolver.AddRelu() != kTfLiteOk){
+		fprintf(stderr, "Could not add the ops\n");
+		return 1;
+	}
+	ScratchRecordingOpResolver op_resolver(micro_op_resolver);
+
+	alignas(16) static uint8_t tensor_arena[PROBE_ARENA_SIZE];
+	tflite::RecordingMicroInterpreter interpreter(
+		model, op_resolver, tensor_arena, PROBE_ARENA_SIZE, error_reporter);
+	if(interpreter.AllocateTensors() != kTfLiteOk){
+		fprintf(stderr, "AllocateTensors() failed\n");
+		return 1;
+	}
+
+	const tflite::RecordingMicroAllocator& allocator = interpreter.GetMicroAllocator();
+	const tflite::RecordingSimpleMemoryAllocator* memory = allocator.GetSimpleMemoryAllocator();
+	size_t used = interpreter.arena_used_bytes();
+	size_t head = memory->GetHeadUsedBytes();
+	size_t tail = memory->GetTailUsedBytes();
+
+	printf("Arena of MFCC21.h, %zu bit host\n", sizeof(void*) * 8);
+	printf(" Head (non-persistent)             %8zu bytes\n", head);
+	// The planner overlaps the scratch buffers with tensors where their
+	// lifetimes allow, the split is an estimate
+	printf("  %-32s %8zu bytes\n", "tensor data", head > scratch_bytes ? head - scratch_bytes : 0);
+	printf("  %-32s %8zu bytes %6s %14d buffers\n", "scratch", scratch_bytes, "", scratch_buffers);
+	printf(" Tail (persistent)                 %8zu bytes\n", tail);
+	size_t recorded = 0;
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kTfLiteEvalTensorData,
+			"eval tensors");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kPersistentTfLiteTensorData,
+			"persistent tensors");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kPersistentTfLiteTensorQuantizationData,
+			"tensor quantization");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kPersistentBufferData,
+			"persistent buffers");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kTfLiteTensorVariableBufferData,
+			"variable tensor buffers");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kNodeAndRegistrationArray,
+			"node and registration structs");
+	recorded += print_allocation(allocator, tflite::RecordedAllocationType::kOpData,
+			"op persistent data");
+	printf("  %-32s %8zu bytes\n", "allocator and handles", tail > recorded ? tail - recorded : 0);
+	printf(" Used                              %8zu bytes\n", used);
+
+	size_t margin = used * margin_percent / 100;
+	if(margin < MARGIN_MIN){
+		margin = MARGIN_MIN;
+	}
+	size_t size = (used + margin + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT * ARENA_ALIGNMENT;
+	printf(" Arena size with %d%% margin        %8zu bytes\n", margin_percent, size);
+	if(sizeof(void*) != 4){
+		printf("Sized with %zu bit pointers, build with -m32 for the size on the target\n", sizeof(void*) * 8);
+	}
+
+	FILE* out = fopen(header_path, "w");
+	if(out == nullptr){
+		perror(header_path);
+		return 1;
+	}
+	fprintf(out,
+		"/*\n"
+		" * tensor_arena_size.h\n"
+		" *\n"
+		" *  Generated by Tests/arena_sizer.cpp from MFCC21.h, do not edit. Rerun\n"
+		" *  it when the model or the kernels change.\n"
+		" *\n"
+		" *  Measured with %zu bit pointers: %zu bytes head (%zu scratch), %zu bytes\n"
+		" *  tail, %d%% margin.\n"
+		" */\n"
+		"\n"
+		"#ifndef INC_TENSOR_ARENA_SIZE_H_\n"
+		"#define INC_TENSOR_ARENA_SIZE_H_\n"
+		"\n"
+		"#define TENSOR_ARENA_USED %zu // Bytes AllocateTensors() needs\n"
+		"#define TENSOR_ARENA_SIZE %zu\n"
+		"\n"
+		"#endif /* INC_TENSOR_ARENA_SIZE_H_ */\n",
+		sizeof(void*) * 8, head, scratch_bytes, tail, margin_percent, used, size);
+	fclose(out);
+	printf("Wrote %s\n", header_path);
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * cmsis_host_dsp.h
+ *
+ *  Plain C versions of the SIMD intrinsics CMSIS-NN uses with ARM_MATH_DSP,
+ *  which cmsis_gcc.h only provides for cores with the DSP extension. Force
+ *  included (-include cmsis_host_dsp.h) when the kernels are built on the
+ *  host with -DARM_MATH_DSP, so that they take the same paths and request the
+ *  same scratch buffers as on the Cortex-M4.
+ */
+
+#ifndef TESTS_CMSIS_HOST_DSP_H_
+#define TESTS_CMSIS_HOST_DSP_H_
+
+#include <stdint.h>
+
+#ifndef __cplusplus
+// arm_nn_mat_mult_nt_t_s8.c issues SXTB16 as inline assembly when the
+// rotation is a constant, this keeps it on __SXTB16 below
+#define __builtin_constant_p(x) 0
+#endif
+
+#define __PKHBT(ARG1, ARG2, ARG3) ((((uint32_t)(ARG1)) & 0x0000FFFFUL) | \
+		((((uint32_t)(ARG2)) << (ARG3)) & 0xFFFF0000UL))
+#define __PKHTB(ARG1, ARG2, ARG3) ((((uint32_t)(ARG1)) & 0xFFFF0000UL) | \
+		(((uint32_t)(((int32_t)(ARG2)) >> (ARG3))) & 0x0000FFFFUL))
+
+static inline uint32_t host_halfwords(int32_t low, int32_t high){
+	return ((uint32_t)low & 0xFFFF) | ((uint32_t)high << 16);
+}
+
+static inline int32_t host_saturate(int64_t value, int32_t min, int32_t max){
+	return value > max ? max : value < min ? min : (int32_t)value;
+}
+
+static inline int32_t host_saturate16(int32_t value){
+	return host_saturate(value, INT16_MIN, INT16_MAX);
+}
+
+static inline int32_t host_saturate8(int32_t value){
+	return host_saturate(value, INT8_MIN, INT8_MAX);
+}
+
+static inline int32_t __QADD(int32_t op1, int32_t op2){
+	return host_saturate((int64_t)op1 + op2, INT32_MIN, INT32_MAX);
+}
+
+static inline int32_t __QSUB(int32_t op1, int32_t op2){
+	return host_saturate((int64_t)op1 - op2, INT32_MIN, INT32_MAX);
+}
+
+static inline uint32_t __SXTB16(uint32_t op1){
+	return host_halfwords((int8_t)op1, (int8_t)(op1 >> 16));
+}
+
+static inline uint32_t __SXTAB16(uint32_t op1, uint32_t op2){
+	return host_halfwords((int16_t)op1 + (int8_t)op2, (int16_t)(op1 >> 16) + (int8_t)(op2 >> 16));
+}
+
+static inline uint32_t __SADD16(uint32_t op1, uint32_t op2){
+	return host_halfwords((int16_t)op1 + (int16_t)op2, (int16_t)(op1 >> 16) + (int16_t)(op2 >> 16));
+}
+
+static inline uint32_t __QADD16(uint32_t op1, uint32_t op2){
+	return host_halfwords(host_saturate16((int16_t)op1 + (int16_t)op2),
+			host_saturate16((int16_t)(op1 >> 16) + (int16_t)(op2 >> 16)));
+}
+
+static inline uint32_t __QSUB16(uint32_t op1, uint32_t op2){
+	return host_halfwords(host_saturate16((int16_t)op1 - (int16_t)op2),
+			host_saturate16((int16_t)(op1 >> 16) - (int16_t)(op2 >> 16)));
+}
+
+static inline uint32_t __QSUB8(uint32_t op1, uint32_t op2){
+	uint32_t result = 0;
+	for(int i = 0; i < 32; i += 8){
+		result |= ((uint32_t)host_saturate8((int8_t)(op1 >> i) - (int8_t)(op2 >> i)) & 0xFF) << i;
+	}
+	return result;
+}
+
+static inline uint32_t __SMUAD(uint32_t op1, uint32_t op2){
+	return (uint32_t)((int32_t)(int16_t)op1 * (int16_t)op2 +
+			(int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16));
+}
+
+static inline uint32_t __SMLAD(uint32_t op1, uint32_t op2, uint32_t op3){
+	return op3 + (uint32_t)((int32_t)(int16_t)op1 * (int16_t)op2 +
+			(int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16));
+}
+
+static inline uint64_t __SMLALD(uint32_t op1, uint32_t op2, uint64_t acc){
+	return acc + (uint64_t)(int64_t)((int32_t)(int16_t)op1 * (int16_t)op2 +
+			(int64_t)((int32_t)(int16_t)(op1 >> 16) * (int16_t)(op2 >> 16)));
+}
+
+#endif /* TESTS_CMSIS_HOST_DSP_H_ */
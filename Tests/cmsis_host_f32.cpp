@@ -0,0 +1,89 @@
+/*
+ * cmsis_host_f32.cpp
+ *
+ *  Plain C++ versions of the float32 CMSIS-DSP functions the front-end
+ *  calls, for the host builds in Tests/. The tree only has the CMSIS-DSP
+ *  headers, the library sources are not part of it. The results agree with
+ *  the library up to float rounding, the times say nothing about the
+ *  Cortex-M4 versions.
+ */
+
+#include <arm_math.h>
+#include <assert.h>
+#include <math.h>
+#include <complex>
+#include <vector>
+
+void arm_dot_prod_f32(const float32_t* pSrcA, const float32_t* pSrcB, uint32_t blockSize, float32_t* result){
+	float32_t sum = 0.0f;
+	for(uint32_t i = 0; i < blockSize; i++){
+		sum += pSrcA[i] * pSrcB[i];
+	}
+	*result = sum;
+}
+
+void arm_cmplx_mult_cmplx_f32(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst, uint32_t numSamples){
+	for(uint32_t i = 0; i < numSamples; i++){
+		float32_t re = pSrcA[2 * i] * pSrcB[2 * i] - pSrcA[2 * i + 1] * pSrcB[2 * i + 1];
+		float32_t im = pSrcA[2 * i] * pSrcB[2 * i + 1] + pSrcA[2 * i + 1] * pSrcB[2 * i];
+		pDst[2 * i] = re;
+		pDst[2 * i + 1] = im;
+	}
+}
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32* S, uint16_t fftLen){
+	if(fftLen < 2 || (fftLen & (fftLen - 1)) != 0){
+		return ARM_MATH_ARGUMENT_ERROR;
+	}
+	S->fftLenRFFT = fftLen;
+	return ARM_MATH_SUCCESS;
+}
+
+// Forward transform only, in double precision. The output is packed like the
+// library's: X[0] and X[N/2] (both real) first, then X[1] to X[N/2 - 1].
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32* S, float32_t* p, float32_t* pOut, uint8_t ifftFlag){
+	assert(ifftFlag == 0);
+	uint32_t n = S->fftLenRFFT;
+	std::vector<std::complex<double>> x(n);
+	for(uint32_t i = 0, j = 0; i < n; i++){
+		x[j] = p[i];
+		// Bit reversed index of i + 1
+		uint32_t bit = n >> 1;
+		while(j & bit){
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+	}
+	for(uint32_t length = 2; length <= n; length <<= 1){
+		std::complex<double> step = std::polar(1.0, -2.0 * M_PI / length);
+		for(uint32_t start = 0; start < n; start += length){
+			std::complex<double> twiddle = 1.0;
+			for(uint32_t k = 0; k < length / 2; k++){
+				std::complex<double> even = x[start + k];
+				std::complex<double> odd = twiddle * x[start + k + length / 2];
+				x[start + k] = even + odd;
+				x[start + k + length / 2] = even - odd;
+				twiddle *= step;
+			}
+		}
+	}
+	pOut[0] = (float32_t)x[0].real();
+	pOut[1] = (float32_t)x[n / 2].real();
+	for(uint32_t k = 1; k < n / 2; k++){
+		pOut[2 * k] = (float32_t)x[k].real();
+		pOut[2 * k + 1] = (float32_t)x[k].imag();
+	}
+}
+
+void arm_cmplx_mag_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples){
+	for(uint32_t i = 0; i < numSamples; i++){
+		pDst[i] = sqrtf(pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1]);
+	}
+}
+
+void arm_cmplx_mag_squared_f32(const float32_t* pSrc, float32_t* pDst, uint32_t numSamples){
+	for(uint32_t i = 0; i < numSamples; i++){
+		pDst[i] = pSrc[2 * i] * pSrc[2 * i] + pSrc[2 * i + 1] * pSrc[2 * i + 1];
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * cmsis_host_q31.cpp
+ *
+ *  Plain C++ versions of the q31 CMSIS-DSP functions mfcc_q31.cpp calls,
+ *  for the host builds in Tests/. They keep the output formats of the
+ *  library: arm_rfft_q31 scales its output down by the frame length (11.21
+ *  for 1024 points) and arm_cmplx_mag_q31 by another factor of 2 (2.30).
+ *  The transform is computed in double precision and truncated once, the
+ *  library truncates after every stage, which adds a few LSB of noise this
+ *  version does not have.
+ */
+
+#include <arm_math.h>
+#include <math.h>
+#include <complex>
+#include <vector>
+
+arm_status arm_rfft_init_q31(arm_rfft_instance_q31* S, uint32_t fftLenReal, uint32_t ifftFlagR, uint32_t bitReverseFlag){
+	if(fftLenReal < 32 || fftLenReal > 8192 || (fftLenReal & (fftLenReal - 1)) != 0 || ifftFlagR != 0){
+		return ARM_MATH_ARGUMENT_ERROR;
+	}
+	S->fftLenReal = fftLenReal;
+	S->ifftFlagR = ifftFlagR;
+	S->bitReverseFlagR = bitReverseFlag;
+	return ARM_MATH_SUCCESS;
+}
+
+// Forward transform only. pDst holds all fftLenReal complex bins like the
+// library's, the upper half is the conjugate of the lower one.
+void arm_rfft_q31(const arm_rfft_instance_q31* S, q31_t* pSrc, q31_t* pDst){
+	uint32_t n = S->fftLenReal;
+	std::vector<std::complex<double>> x(n);
+	for(uint32_t i = 0, j = 0; i < n; i++){
+		x[j] = pSrc[i];
+		// Bit reversed index of i + 1
+		uint32_t bit = n >> 1;
+		while(j & bit){
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+	}
+	for(uint32_t length = 2; length <= n; length <<= 1){
+		std::complex<double> step = std::polar(1.0, -2.0 * M_PI / length);
+		for(uint32_t start = 0; start < n; start += length){
+			std::complex<double> twiddle = 1.0;
+			for(uint32_t k = 0; k < length / 2; k++){
+				std::complex<double> even = x[start + k];
+				std::complex<double> odd = twiddle * x[start + k + length / 2];
+				x[start + k] = even + odd;
+				x[start + k + length / 2] = even - odd;
+				twiddle *= step;
+			}
+		}
+	}
+	for(uint32_t k = 0; k < n; k++){
+		pDst[2 * k] = (q31_t)floor(x[k].real() / n);
+		pDst[2 * k + 1] = (q31_t)floor(x[k].imag() / n);
+	}
+}
+
+void arm_cmplx_mag_q31(const q31_t* pSrc, q31_t* pDst, uint32_t numSamples){
+	for(uint32_t i = 0; i < numSamples; i++){
+		double re = pSrc[2 * i];
+		double im = pSrc[2 * i + 1];
+		pDst[i] = (q31_t)floor(sqrt(re * re + im * im) / 2);
+	}
+}
@@ -0,0 +1,135 @@
+/*
+ * dct_test.cpp
+ *
+ *  Accuracy of the truncated DCT (Core/Src/ben_dct2_f32.cpp) on the host.
+ *  dct2_truncated_f32 and ben_dct2_f32 are compared with a double precision
+ *  DCT-II scaled like tf.signal.mfccs_from_log_mel_spectrograms, and
+ *  dct2_truncated_int8 with that reference quantized like normalize_mfccs in
+ *  main.cpp. Exits with 1 if one of them is outside its tolerance.
+ *  ben_dct2_f32 runs on the FFT of cmsis_host_f32.cpp, its time is not
+ *  comparable to the target's, see DCT_BENCHMARK in main.cpp for cycles.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o dct_test \
+ *      dct_test.cpp cmsis_host_f32.cpp ../Core/Src/ben_dct2_f32.cpp ../Core/Src/frontend_tables.cpp
+ *  ./dct_test
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "ben_dct2_f32.h"
+#include "frontend_tables.h"
+
+#define VECTORS 1000
+#define CALLS 100000
+
+// Must match main.cpp
+#define INPUT_SCALE 0.003135847859084606
+#define INPUT_ZERO_POINT -128
+
+// Tolerances
+#define FLOAT_TOL 1e-4 // relative to the largest coefficient
+#define INT8_TOL 1     // quantization steps
+
+static void dct2_reference(const float32_t* log_mel, double* mfccs){
+	for(int k = 0; k < N_MFCC_COEFFS; k++){
+		double sum = 0.0;
+		for(int n = 0; n < N_MEL_BANDS; n++){
+			sum += log_mel[n] * cos(M_PI * k * (2 * n + 1) / (2.0 * N_MEL_BANDS));
+		}
+		mfccs[k] = sqrt(2.0 / N_MEL_BANDS) * sum;
+	}
+}
+
+// normalize_mfccs in main.cpp, saturating
+static int quantize(double mfcc){
+	double q = trunc((mfcc / 512 + 0.5) / INPUT_SCALE + INPUT_ZERO_POINT);
+	return q > 127 ? 127 : q < -128 ? -128 : (int)q;
+}
+
+// Log mel spectrograms between the floor of log(1e-6) and loud frames
+static void test_vector(int index, float32_t* log_mel){
+	uint32_t seed = index + 1;
+	for(int i = 0; i < N_MEL_BANDS; i++){
+		seed = seed * 1664525 + 1013904223;
+		float32_t noise = (float32_t)(seed >> 8) / (1 << 24) - 0.5f;
+		if(index == 0){
+			// The synthetic spectrogram of DCT_BENCHMARK
+			log_mel[i] = 8.0f + 4.0f * sinf(0.3f * i) - 0.05f * i;
+		} else {
+			log_mel[i] = (index % 3 == 0 ? -13.8f : 0.0f) + (float32_t)(index % 30) * noise + 0.1f * index * noise;
+		}
+	}
+}
+
+static bool check(const char* name, double error, double tol){
+	bool ok = error <= tol;
+	printf("%-12s max error %.6f (tolerance %g) %s\n", name, error, tol, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(){
+	arm_rfft_fast_instance_f32 rfft_dct;
+	arm_rfft_fast_init_f32(&rfft_dct, N_MEL_BANDS);
+	double error_trunc = 0.0;
+	double error_ben = 0.0;
+	int deviation_int8 = 0;
+
+	for(int v = 0; v < VECTORS; v++){
+		float32_t log_mel[N_MEL_BANDS];
+		float32_t inline_buffer[N_MEL_BANDS];
+		float32_t state[2 * N_MEL_BANDS];
+		float32_t mfccs_trunc[N_MFCC_COEFFS];
+		float32_t mfccs_ben[N_MFCC_COEFFS];
+		int8_t mfccs_int8[N_MFCC_COEFFS];
+		double reference[N_MFCC_COEFFS];
+		test_vector(v, log_mel);
+		dct2_reference(log_mel, reference);
+		dct2_truncated_f32(log_mel, mfccs_trunc);
+		dct2_truncated_int8(log_mel, mfccs_int8);
+		// ben_dct2_f32 overwrites its input
+		memcpy(inline_buffer, log_mel, sizeof(log_mel));
+		ben_dct2_f32(inline_buffer, state, mfccs_ben, &rfft_dct);
+
+		double scale = 0.0;
+		for(int k = 0; k < N_MFCC_COEFFS; k++){
+			scale = fmax(scale, fabs(reference[k]));
+		}
+		for(int k = 0; k < N_MFCC_COEFFS; k++){
+			error_trunc = fmax(error_trunc, fabs(mfccs_trunc[k] - reference[k]) / scale);
+			error_ben = fmax(error_ben, fabs(mfccs_ben[k] - reference[k]) / scale);
+			deviation_int8 = std::max(deviation_int8, abs(mfccs_int8[k] - quantize(reference[k])));
+		}
+	}
+
+	bool passed = true;
+	passed &= check("trunc f32", error_trunc, FLOAT_TOL);
+	passed &= check("ben_dct2", error_ben, FLOAT_TOL);
+	passed &= check("trunc int8", deviation_int8, INT8_TOL);
+
+	float32_t log_mel[N_MEL_BANDS];
+	float32_t mfccs[N_MFCC_COEFFS];
+	int8_t mfccs_int8[N_MFCC_COEFFS];
+	test_vector(0, log_mel);
+	auto start = std::chrono::steady_clock::now();
+	for(int i = 0; i < CALLS; i++){
+		dct2_truncated_f32(log_mel, mfccs);
+		log_mel[i % N_MEL_BANDS] += mfccs[0] * 1e-9f;
+	}
+	auto middle = std::chrono::steady_clock::now();
+	for(int i = 0; i < CALLS; i++){
+		dct2_truncated_int8(log_mel, mfccs_int8);
+		log_mel[i % N_MEL_BANDS] += mfccs_int8[0] * 1e-9f;
+	}
+	auto end = std::chrono::steady_clock::now();
+	printf("trunc f32 %.0f ns, trunc int8 %.0f ns per call\n",
+			std::chrono::duration<double, std::nano>(middle - start).count() / CALLS,
+			std::chrono::duration<double, std::nano>(end - middle).count() / CALLS);
+
+	printf(passed ? "PASSED\n" : "FAILED\n");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,166 @@
+import re
+import numpy as np
+import pandas as pd
+import tensorflow as tf
+
+# Replays a recording through the model at every feature row and evaluates the
+# inference cadence and the detector of main.cpp (INFERENCE_STRIDE,
+# TRIGGER_REFRACTORY, DETECTOR_*) offline. The audio is an MCU log as for
+# mfcc.py, the model is read from Core/Inc/MFCC21.h. For every configuration the
+# number of Invoke() calls, the cycles saved against the baseline (stride 1, no
+# smoothing) and the recall and false detections of the keyword are reported.
+# Without KEYWORD_TIMES the detections of the baseline are the reference.
+
+INPUT = "MFCC/test03/test01"
+MODEL_HEADER = "../Core/Inc/MFCC21.h"
+SAMPLERATE = 9524
+
+# Must match main.cpp and ring_buffer.h
+FRAME_LENGTH = 1024
+BUFFERSIZE = 93
+INPUT_SCALE = 0.003135847859084606
+INPUT_ZERO_POINT = -128
+MIN_DIST = 20
+KEYWORD = 1
+
+INVOKE_CYCLES = 8000000 # Cycles of one Invoke(), see the "#####" lines of the UART log
+KEYWORD_TIMES = [] # Seconds of the keywords in the recording, if known
+TOLERANCE_ROWS = 10 # A detection counts this many rows around a keyword
+
+# stride, smoothing, length, thresholds (noise, keyword, silence)
+BASELINE = (1, "mean", 1, (-128, -128, -128))
+CONFIGS = [
+  BASELINE,
+  (2, "mean", 1, (-128, -128, -128)),
+  (4, "mean", 1, (-128, -128, -128)),
+  (4, "mean", 2, (-128, -128, -128)),
+  (4, "max", 2, (-128, -128, -128)),
+  (4, "mean", 3, (-128, 0, -128)),
+  (6, "mean", 2, (-128, -128, -128)),
+  (8, "max", 2, (-128, -128, -128)),
+]
+
+
+class Detector:
+  # Mirrors detector.cpp
+  def __init__(self, smoothing, length, thresholds):
+    self.smoothing = smoothing
+    self.length = length
+    self.thresholds = thresholds
+    self.reset()
+
+  def reset(self):
+    self.history = []
+
+  def update(self, output):
+    self.history = (self.history + [list(output)])[-self.length:]
+    history = np.array(self.history, dtype=np.int32)
+    if self.smoothing == "max":
+      scores = history.max(axis=0)
+    else:
+      scores = np.floor_divide(history.sum(axis=0), len(self.history))
+
+    best = int(np.argmax(scores))
+    if np.sum(scores == scores[best]) > 1 or scores[best] < self.thresholds[best]:
+      return None
+    return best
+
+
+def read_model(path):
+  # The C array of the flatbuffer
+  with open(path) as f:
+    text = f.read()
+  body = text[text.index("{") + 1:text.index("}")]
+  return bytes(int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]{2}", body))
+
+
+def quantize(mfccs):
+  # normalize_mfccs in main.cpp
+  return np.trunc((mfccs / 512 + 0.5) / INPUT_SCALE + INPUT_ZERO_POINT).clip(-128, 127).astype(np.int8)
+
+
+def replay(posteriors, stride, smoothing, length, thresholds):
+  # Same cadence as do_inference, posteriors[r] belongs to the window ending with row r.
+  # row - last counts the rows inserted since the last inference.
+  detector = Detector(smoothing, length, thresholds)
+  last = None
+  triggered = False
+  invocations = 0
+  detections = []
+  for row in sorted(posteriors):
+    if last is not None:
+      new_rows = row - last
+      if triggered and new_rows >= MIN_DIST:
+        triggered = False
+      if new_rows < stride or triggered:
+        continue
+    last = row
+    invocations += 1
+    if detector.update(posteriors[row]) == KEYWORD:
+      detections.append(row)
+      triggered = True
+      detector.reset()
+  return invocations, detections
+
+
+def score(detections, reference):
+  matched = set()
+  false_detections = 0
+  for row in detections:
+    hits = [i for i, ref in enumerate(reference) if abs(ref - row) <= TOLERANCE_ROWS and i not in matched]
+    if hits:
+      matched.add(hits[0])
+    else:
+      false_detections += 1
+  recall = len(matched) / len(reference) if reference else 1.0
+  return recall, false_detections
+
+
+# Read in the audio, every non numeric item is a marker or noise
+raw = pd.read_csv(INPUT + ".log", header=None, encoding='unicode_escape')
+audio = []
+for item in list(raw[0]):
+  try:
+    audio.append(float(item))
+  except ValueError:
+    pass
+audio = np.array(audio).astype(np.float32)
+
+### Feature rows as in the training pipeline
+stfts = tf.signal.stft(tf.convert_to_tensor(audio[np.newaxis, ...]), FRAME_LENGTH, FRAME_LENGTH, FRAME_LENGTH)[:,:,:-1]
+linear_to_mel_weight_matrix = tf.signal.linear_to_mel_weight_matrix(64, stfts.shape[-1], SAMPLERATE, 80.0, 4700.0)
+mel_spectrograms = tf.tensordot(tf.abs(stfts), linear_to_mel_weight_matrix, 1)
+mfccs = tf.signal.mfccs_from_log_mel_spectrograms(tf.math.log(mel_spectrograms + 1e-6))[..., :13]
+rows = quantize(mfccs.numpy()[0])
+print("{} feature rows, {:.1f} s".format(rows.shape[0], rows.shape[0] * FRAME_LENGTH / SAMPLERATE))
+
+### Model output for the window ending at every row
+interpreter = tf.lite.Interpreter(model_content=read_model(MODEL_HEADER))
+interpreter.allocate_tensors()
+input_index = interpreter.get_input_details()[0]['index']
+output_index = interpreter.get_output_details()[0]['index']
+
+posteriors = {}
+for row in range(BUFFERSIZE, rows.shape[0] + 1):
+  window = rows[row - BUFFERSIZE:row].reshape(1, BUFFERSIZE, rows.shape[1], 1)
+  interpreter.set_tensor(input_index, window)
+  interpreter.invoke()
+  posteriors[row] = interpreter.get_tensor(output_index)[0]
+
+### Replay
+baseline_invocations, baseline_detections = replay(posteriors, *BASELINE)
+if KEYWORD_TIMES:
+  reference = [int(t * SAMPLERATE / FRAME_LENGTH) + 1 for t in KEYWORD_TIMES]
+else:
+  reference = baseline_detections
+print("Reference: {} keywords".format(len(reference)))
+
+print("{:>6s} {:>6s} {:>6s} {:>18s} | {:>7s} {:>11s} {:>7s} {:>7s}".format(
+  "stride", "smooth", "length", "thresholds", "invokes", "cycles saved", "recall", "false"))
+for stride, smoothing, length, thresholds in CONFIGS:
+  invocations, detections = replay(posteriors, stride, smoothing, length, thresholds)
+  recall, false_detections = score(detections, reference)
+  saved = (baseline_invocations - invocations) * INVOKE_CYCLES
+  print("{:6d} {:>6s} {:6d} {:>18s} | {:7d} {:10.1f}% {:7.2f} {:7d}".format(
+    stride, smoothing, length, str(thresholds), invocations,
+    100.0 * saved / (baseline_invocations * INVOKE_CYCLES), recall, false_detections))
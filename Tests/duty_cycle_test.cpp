@@ -0,0 +1,102 @@
+/*
+ * duty_cycle_test.cpp
+ *
+ *  Unit test of the scheduling logic of SLEEP_UNTIL_WORK and
+ *  DUTY_CYCLE_REPORT (Core/Src/duty_cycle.cpp) on the host: the period
+ *  accounting, including the wraparound of the HAL tick, the SysTick down
+ *  counter across a reload and the sleep decision of sleep_until_work() in
+ *  main.cpp. Exits with 1 if a check fails.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o duty_cycle_test \
+ *      duty_cycle_test.cpp ../Core/Src/duty_cycle.cpp
+ *  ./duty_cycle_test
+ */
+
+#include <cstdio>
+#include "duty_cycle.h"
+
+#define CYCLES_PER_MS 80000 // SYSCLK / 1000
+#define PERIOD_MS 5000
+
+static int failures = 0;
+
+static void check(bool ok, const char* what){
+	if(!ok){
+		printf("FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+static void test_period(void){
+	struct DutyCycle duty_cycle;
+	struct DutyCycleReport report;
+	init_duty_cycle(&duty_cycle, PERIOD_MS, CYCLES_PER_MS, 1000);
+
+	check(!duty_cycle_period_finished(&duty_cycle, 1000 + PERIOD_MS - 1, &report), "period not finished early");
+	duty_cycle_add_sleep(&duty_cycle, 100000000);
+	duty_cycle_add_sleep(&duty_cycle, 200000000);
+	check(duty_cycle_period_finished(&duty_cycle, 1000 + PERIOD_MS, &report), "period finished on time");
+	check(report.total_cycles == (uint64_t)PERIOD_MS * CYCLES_PER_MS, "total cycles of the period");
+	check(report.sleep_cycles == 300000000, "sleep cycles summed");
+	check(report.wakeups == 2, "wakeups counted");
+	check(report.active_permille == 250, "active share of 100 of 400 Mcycles");
+
+	// The next period starts where the last one was reported
+	check(!duty_cycle_period_finished(&duty_cycle, 1000 + 2 * PERIOD_MS - 1, &report), "next period not finished");
+	check(duty_cycle_period_finished(&duty_cycle, 1000 + 2 * PERIOD_MS, &report), "next period finished");
+	check(report.sleep_cycles == 0 && report.wakeups == 0 && report.active_permille == 1000,
+			"counters reset, always active");
+}
+
+static void test_sleep_clamped(void){
+	struct DutyCycle duty_cycle;
+	struct DutyCycleReport report;
+	init_duty_cycle(&duty_cycle, PERIOD_MS, CYCLES_PER_MS, 0);
+
+	// The tick has millisecond resolution, the exact sleep can exceed the period
+	duty_cycle_add_sleep(&duty_cycle, PERIOD_MS * CYCLES_PER_MS + 500);
+	check(duty_cycle_period_finished(&duty_cycle, PERIOD_MS, &report), "clamped period finished");
+	check(report.sleep_cycles == report.total_cycles && report.active_permille == 0, "sleep clamped to the period");
+}
+
+static void test_tick_wraparound(void){
+	struct DutyCycle duty_cycle;
+	struct DutyCycleReport report;
+	uint32_t start = UINT32_MAX - 1000;
+	init_duty_cycle(&duty_cycle, PERIOD_MS, CYCLES_PER_MS, start);
+
+	check(!duty_cycle_period_finished(&duty_cycle, 100, &report), "not finished 1101 ms after start across the wrap");
+	check(duty_cycle_period_finished(&duty_cycle, start + PERIOD_MS + 10, &report), "finished across the wrap");
+	check(report.total_cycles == (uint64_t)(PERIOD_MS + 10) * CYCLES_PER_MS, "elapsed time across the wrap");
+}
+
+static void test_down_counter(void){
+	const uint32_t period = CYCLES_PER_MS; // SysTick->LOAD + 1
+	check(down_counter_elapsed(50000, 20000, period) == 30000, "counter without reload");
+	check(down_counter_elapsed(1000, 1000, period) == 0, "counter unchanged");
+	check(down_counter_elapsed(1000, period - 2000, period) == 3000, "counter across one reload");
+	check(down_counter_elapsed(0, period - 1, period) == 1, "reload right after the read");
+}
+
+static void test_sleep_decision(void){
+	// Front-end in the main loop: a queued block or a due inference keep it awake
+	check(may_sleep(false, false, true), "idle loop sleeps");
+	check(!may_sleep(true, false, true), "queued block keeps the loop awake");
+	check(!may_sleep(false, true, true), "due inference keeps the loop awake");
+	check(!may_sleep(true, true, true), "both pending");
+	// Front-end in PendSV or polled: only the inference is the loop's work
+	check(may_sleep(true, false, false), "block left to PendSV or polling");
+	check(!may_sleep(false, true, false), "due inference with deferred front-end");
+}
+
+int main(){
+	test_period();
+	test_sleep_clamped();
+	test_tick_wraparound();
+	test_down_counter();
+	test_sleep_decision();
+
+	printf(failures == 0 ? "PASSED\n" : "FAILED\n");
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/*
+ * frame_preprocess_test.cpp
+ *
+ *  Checks preprocess_frame_f32 (Core/Src/frame_preprocess.cpp) on the host
+ *  against a double precision reference of conversion, pre-emphasis and the
+ *  periodic Hann window of tf.signal.stft, with and without either stage,
+ *  and that the pre-emphasis removes the DC of a constant frame. Exits with
+ *  1 if a case is outside its tolerance.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o frame_preprocess_test \
+ *      frame_preprocess_test.cpp ../Core/Src/frame_preprocess.cpp ../Core/Src/frontend_tables.cpp
+ *  ./frame_preprocess_test
+ */
+
+#include <cmath>
+#include <cstdio>
+#include "frame_preprocess.h"
+#include "frontend_tables.h"
+
+#define FRAME_LENGTH WINDOW_LENGTH
+#define TOL 1e-6 // relative to the largest reference sample
+
+static int32_t samples[FRAME_LENGTH];
+static float32_t frame[FRAME_LENGTH];
+
+static double hann(int n){
+	return 0.5 - 0.5 * cos(2.0 * M_PI * n / FRAME_LENGTH);
+}
+
+// 24 bit DFSDM words of a tone and noise in the upper bits
+static void fill_samples(int32_t dc){
+	uint32_t seed = 1;
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		seed = seed * 1664525 + 1013904223;
+		int32_t noise = (int32_t)(seed >> 16) - 32768;
+		int32_t tone = (int32_t)(2000000.0 * sin(2.0 * M_PI * 440.0 * i / 9524.0));
+		samples[i] = (dc + tone + noise) * 256;
+	}
+}
+
+static bool check_case(const char* name, float32_t pre_emphasis, const float32_t* window){
+	preprocess_frame_f32(samples, frame, FRAME_LENGTH, pre_emphasis, window);
+
+	double max_ref = 0.0;
+	double max_error = 0.0;
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		double x = samples[i] >> 8;
+		double prev = samples[i > 0 ? i - 1 : 0] >> 8;
+		double y = (x - pre_emphasis * prev) * (window != NULL ? hann(i) : 1.0);
+		max_ref = fmax(max_ref, fabs(y));
+		max_error = fmax(max_error, fabs(frame[i] - y));
+	}
+	double error = max_error / max_ref;
+	bool ok = error <= TOL;
+	printf("%-24s max error %.2e (tolerance %g) %s\n", name, error, TOL, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(){
+	bool passed = true;
+
+	double window_error = 0.0;
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		window_error = fmax(window_error, fabs(hann_window_f32[i] - hann(i)));
+	}
+	passed &= window_error <= TOL;
+	printf("%-24s max error %.2e (tolerance %g) %s\n", "hann_window_f32", window_error, TOL,
+			window_error <= TOL ? "ok" : "FAILED");
+
+	fill_samples(0);
+	passed &= check_case("conversion", 0.0f, NULL);
+	passed &= check_case("window", 0.0f, hann_window_f32);
+	passed &= check_case("pre-emphasis", 0.97f, NULL);
+	passed &= check_case("pre-emphasis and window", 0.97f, hann_window_f32);
+	fill_samples(-3000000);
+	passed &= check_case("DC offset", 0.97f, hann_window_f32);
+
+	// A constant frame keeps 1 - pre_emphasis of its DC
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		samples[i] = 1000000 * 256;
+	}
+	preprocess_frame_f32(samples, frame, FRAME_LENGTH, 0.97f, NULL);
+	double dc = 0.0;
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		dc += frame[i] / FRAME_LENGTH;
+	}
+	bool dc_ok = fabs(dc - 0.03 * 1000000) <= 1.0;
+	passed &= dc_ok;
+	printf("%-24s %.1f of 1000000 left %s\n", "DC removal", dc, dc_ok ? "ok" : "FAILED");
+
+	printf(passed ? "PASSED\n" : "FAILED\n");
+	return passed ? 0 : 1;
+}
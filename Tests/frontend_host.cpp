@@ -0,0 +1,246 @@
+/*
+ * frontend_host.cpp
+ *
+ *  Host build of the float32 front-end of main.cpp (trace_frontend_stages)
+ *  with the sources of Core/Src. Runs it on synthetic DFSDM frames, reports
+ *  ns per frame per stage and compares the stages of one frame with the
+ *  golden capture LogData/MFCC/golden/frontend01.log. Exits with 1 if a
+ *  stage differs, so a change of the front-end code shows without
+ *  TensorFlow. With --write the frame is written in the format of
+ *  FRONTEND_DUMP instead, which Tests/frontend_regression.py checks against
+ *  the training pipeline. The golden was written that way and checked
+ *  there; only rewrite it after such a check.
+ *
+ *  The CMSIS-DSP sources are not part of the tree, the FFT and magnitude
+ *  run on the double precision stand-ins of cmsis_host_f32.cpp. The capture
+ *  checks everything around them, the library kernels themselves only a
+ *  board capture checks. Their times are not the target's either.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o frontend_host \
+ *      frontend_host.cpp cmsis_host_f32.cpp ../Core/Src/frame_preprocess.cpp \
+ *      ../Core/Src/linear_to_mel_weight_list.cpp ../Core/Src/ben_dct2_f32.cpp ../Core/Src/frontend_tables.cpp
+ *  ./frontend_host [golden] [frames]
+ *  ./frontend_host --write capture [frames]
+ *
+ *  Add -DFRONTEND_POWER_SPECTRUM for the power spectrum path, it needs a
+ *  golden written by such a build.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "ben_dct2_f32.h"
+#include "frame_preprocess.h"
+#include "frontend_tables.h"
+#include "linear_to_mel_weight_list.h"
+
+#define GOLDEN "LogData/MFCC/golden/frontend01.log"
+#define FRAMES 100
+#define DUMP_FRAME 20 // FRONTEND_DUMP_FRAME
+#define GOLDEN_TOL 1e-5 // relative to the largest value of a stage, int8 and audio are exact
+
+// Must match main.cpp
+#define FRAME_LENGTH WINDOW_LENGTH
+#define SAMPLINGRATE 9524
+#define N_MFCCS 13
+#define PRE_EMPHASIS 0.0f
+#define WINDOW_F32 hann_window_f32
+
+#define STAGES 5
+static const char* stage_names[STAGES] = {"pre", "fft", "mag", "mel", "dct"};
+
+static int32_t samples[FRAME_LENGTH];
+static float32_t buffer1[FRAME_LENGTH];
+static float32_t buffer2[FRAME_LENGTH];
+
+// Voiced frames: harmonics of a gliding pitch shaped by two formants, over
+// noise, as 24 bit DFSDM words in the upper bits
+static void synthesize_frame(int index){
+	static uint32_t seed = 1;
+	static double phase = 0.0;
+	double pitch = 120.0 + 60.0 * sin(0.2 * index);
+	double level = 5000.0 * (1.0 + 0.8 * sin(0.15 * index));
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		phase += 2.0 * M_PI * pitch / SAMPLINGRATE;
+		double x = 0.0;
+		for(int h = 1; h * pitch < SAMPLINGRATE / 2; h++){
+			double f = h * pitch;
+			double gain = 1.0 / (1.0 + pow((f - 700.0) / 150.0, 2)) + 0.5 / (1.0 + pow((f - 1800.0) / 250.0, 2));
+			x += gain * sin(h * phase);
+		}
+		seed = seed * 1664525 + 1013904223;
+		double noise = ((double)(seed >> 8) / (1 << 24) - 0.5) * 2000.0;
+		samples[i] = (int32_t)(level * x + noise) * 256;
+	}
+}
+
+// The stages of one frame as FRONTEND_DUMP prints them
+#define SECTIONS 5
+#ifdef FRONTEND_POWER_SPECTRUM
+static const char* section_names[SECTIONS] = {"Audio", "Power", "LMS", "MFCCs", "Int8"};
+#else
+static const char* section_names[SECTIONS] = {"Audio", "Magnitude", "LMS", "MFCCs", "Int8"};
+#endif
+static const int section_lengths[SECTIONS] = {FRAME_LENGTH, FRAME_LENGTH/2, N_MEL_BANDS, N_MFCCS, N_MFCCS};
+static float32_t sections[SECTIONS][FRAME_LENGTH];
+
+static bool write_capture(const char* path){
+	FILE* file = fopen(path, "wb");
+	if(file == NULL){
+		perror(path);
+		return false;
+	}
+	for(int s = 0; s < SECTIONS; s++){
+		fprintf(file, "%s\r\n", section_names[s]);
+		for(int i = 0; i < section_lengths[s]; i++){
+			fprintf(file, "%.7g\r\n", sections[s][i]);
+		}
+	}
+	fclose(file);
+	printf("Wrote %s\n", path);
+	return true;
+}
+
+// Reads the numbers of section name, returns how many there are
+static int read_section(FILE* file, const char* name, float32_t* values, int max){
+	char line[64];
+	bool found = false;
+	int n = 0;
+	rewind(file);
+	while(fgets(line, sizeof(line), file) != NULL){
+		line[strcspn(line, "\r\n")] = '\0';
+		char* end;
+		double value = strtod(line, &end);
+		if(end == line || *end != '\0'){
+			if(found){
+				break;
+			}
+			found = (strcmp(line, name) == 0);
+		} else if(found && n < max){
+			values[n++] = (float32_t)value;
+		}
+	}
+	return found ? n : -1;
+}
+
+static bool compare_golden(const char* path){
+	FILE* file = fopen(path, "rb");
+	if(file == NULL){
+		perror(path);
+		return false;
+	}
+	bool passed = true;
+	for(int s = 0; s < SECTIONS; s++){
+		static float32_t golden[FRAME_LENGTH];
+		int n = read_section(file, section_names[s], golden, FRAME_LENGTH);
+		if(n != section_lengths[s]){
+			printf("%-10s %d values in %s instead of %d FAILED\n", section_names[s], n, path, section_lengths[s]);
+			passed = false;
+			continue;
+		}
+		double scale = 0.0;
+		double error = 0.0;
+		for(int i = 0; i < n; i++){
+			scale = fmax(scale, fabs(golden[i]));
+			error = fmax(error, fabs(sections[s][i] - golden[i]));
+		}
+		bool exact = (s == 0 || s == SECTIONS - 1);
+		double tol = exact ? 0.0 : GOLDEN_TOL * scale;
+		bool ok = error <= tol;
+		printf("%-10s max deviation %.3g (tolerance %.3g) %s\n", section_names[s], error, tol, ok ? "ok" : "FAILED");
+		passed &= ok;
+	}
+	fclose(file);
+	return passed;
+}
+
+int main(int argc, char** argv){
+	// The golden is only written to a path given explicitly
+	bool write = argc > 1 && strcmp(argv[1], "--write") == 0;
+	if(write && argc < 3){
+		fprintf(stderr, "--write needs the path of the capture\n");
+		return 1;
+	}
+	int arg = write ? 2 : 1;
+	const char* capture = argc > arg ? argv[arg] : GOLDEN;
+	int frames = argc > arg + 1 ? atoi(argv[arg + 1]) : FRAMES;
+	if(frames <= DUMP_FRAME){
+		fprintf(stderr, "Frame %d is compared, run at least %d frames\n", DUMP_FRAME, DUMP_FRAME + 1);
+		return 1;
+	}
+	arm_rfft_fast_instance_f32 rfft_frame;
+	arm_rfft_fast_init_f32(&rfft_frame, FRAME_LENGTH);
+	double ns_sum[STAGES] = {0};
+	double ns_min[STAGES];
+	double ns_max[STAGES] = {0};
+	for(int s = 0; s < STAGES; s++){
+		ns_min[s] = INFINITY;
+	}
+
+	for(int index = 0; index < frames; index++){
+		int8_t mfccs_int8[N_MFCCS];
+		std::chrono::steady_clock::time_point t[STAGES + 1];
+		synthesize_frame(index);
+
+		t[0] = std::chrono::steady_clock::now();
+		preprocess_frame_f32(samples, buffer1, FRAME_LENGTH, PRE_EMPHASIS, WINDOW_F32);
+		t[1] = std::chrono::steady_clock::now();
+		arm_rfft_fast_f32(&rfft_frame, buffer1, buffer2, 0);
+		t[2] = std::chrono::steady_clock::now();
+#ifdef FRONTEND_POWER_SPECTRUM
+		arm_cmplx_mag_squared_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#else
+		arm_cmplx_mag_f32(buffer2, buffer1, FRAME_LENGTH/2);
+#endif
+		t[3] = std::chrono::steady_clock::now();
+		float32_t spectrum[FRAME_LENGTH/2];
+		for(int i = 0; i < FRAME_LENGTH/2; i++){
+			spectrum[i] = buffer1[i];
+		}
+#ifdef FRONTEND_POWER_SPECTRUM
+		calc_log_mel_spectrogram_power(buffer1, buffer2);
+#else
+		calc_log_mel_spectrogram(buffer1, buffer2);
+#endif
+		t[4] = std::chrono::steady_clock::now();
+		dct2_truncated_int8(buffer2, mfccs_int8);
+		t[5] = std::chrono::steady_clock::now();
+
+		for(int s = 0; s < STAGES; s++){
+			double ns = std::chrono::duration<double, std::nano>(t[s + 1] - t[s]).count();
+			ns_sum[s] += ns;
+			ns_min[s] = fmin(ns_min[s], ns);
+			ns_max[s] = fmax(ns_max[s], ns);
+		}
+
+		if(index == DUMP_FRAME){
+			for(int i = 0; i < FRAME_LENGTH; i++){
+				sections[0][i] = (float32_t)(samples[i] >> 8);
+			}
+			memcpy(sections[1], spectrum, sizeof(spectrum));
+			memcpy(sections[2], buffer2, N_MEL_BANDS * sizeof(float32_t));
+			dct2_truncated_f32(buffer2, sections[3]);
+			for(int i = 0; i < N_MFCCS; i++){
+				sections[4][i] = mfccs_int8[i];
+			}
+		}
+	}
+
+	printf("%-6s %10s %10s %10s\n", "stage", "min ns", "mean ns", "max ns");
+	double total = 0.0;
+	for(int s = 0; s < STAGES; s++){
+		printf("%-6s %10.0f %10.0f %10.0f\n", stage_names[s], ns_min[s], ns_sum[s] / frames, ns_max[s]);
+		total += ns_sum[s] / frames;
+	}
+	printf("%-6s %21.0f ns per frame\n", "total", total);
+
+	if(write){
+		return write_capture(capture) ? 0 : 1;
+	}
+	bool passed = compare_golden(capture);
+	printf(passed ? "PASSED\n" : "FAILED\n");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+import sys
+import numpy as np
+import pandas as pd
+import tensorflow as tf
+
+# Regression check of the float32 front-end against tensorflow. The input is a
+# UART log of a board built with FRONTEND_DUMP, which prints one frame as the
+# sections Audio, Magnitude (or Power with FRONTEND_POWER_SPECTRUM), LMS, MFCCs
+# and Int8. Every stage is compared with the training pipeline and the script
+# exits with 1 if one of them is outside its tolerance. Pass the path of a
+# capture, the default is the golden frame Tests/frontend_host.cpp wrote with
+# --write from the host build of the front-end. frontend_host compares itself
+# with that golden on every run.
+
+INPUT = "MFCC/golden/frontend01"
+SAMPLERATE = 9524
+
+# Must match main.cpp
+PRE_EMPHASIS = 0.0
+WINDOW = True
+INPUT_SCALE = 0.003135847859084606
+INPUT_ZERO_POINT = -128
+
+# Tolerances per stage
+MAGNITUDE_TOL = 1e-4 # relative to the largest bin
+LMS_TOL = 0.02 # natural log units
+MFCC_TOL = 0.05
+INT8_TOL = 1 # quantization steps
+# The power spectrum path only approximates the log mel spectrogram
+POWER_LMS_TOL = 1.5
+POWER_INT8_TOL = 3
+
+sections = ["Audio", "Magnitude", "Power", "LMS", "MFCCs", "Int8"]
+
+
+def quantize(mfccs):
+  # normalize_mfccs in main.cpp
+  return np.trunc((mfccs / 512 + 0.5) / INPUT_SCALE + INPUT_ZERO_POINT).clip(-128, 127)
+
+
+def check(name, error, tol):
+  ok = error <= tol
+  print("{:10s} max error {:.6f} (tolerance {}) {}".format(name, error, tol, "ok" if ok else "FAILED"))
+  return ok
+
+
+# Read in the log, noise between the sections is skipped
+raw = pd.read_csv(INPUT + ".log" if len(sys.argv) < 2 else sys.argv[1], header=None, encoding='unicode_escape')
+
+mcu_data = {}
+current = None
+noisy_items = 0
+for item in list(raw[0]):
+  item = str(item).strip()
+  if item in sections:
+    current = item
+    mcu_data[current] = []
+    continue
+  try:
+    mcu_data[current].append(float(item))
+  except (ValueError, KeyError):
+    noisy_items += 1
+
+print("Num noisy items: {}".format(noisy_items))
+
+power_path = "Power" in mcu_data
+audio = np.array(mcu_data["Audio"]).astype(np.float32)
+frame_length = audio.shape[0]
+
+### Reference as in the training pipeline
+lower_edge_hertz, upper_edge_hertz, num_mel_bins = 80.0, 4700.0, 64
+
+frame = audio.copy()
+if PRE_EMPHASIS != 0.0:
+  frame[1:] -= PRE_EMPHASIS * audio[:-1]
+  frame[0] -= PRE_EMPHASIS * audio[0]
+
+window_fn = tf.signal.hann_window if WINDOW else None
+stfts = tf.signal.stft(tf.convert_to_tensor(frame[np.newaxis, ...]), frame_length, frame_length, frame_length,
+                       window_fn=window_fn)[:,:,:-1]
+spectrograms = tf.abs(stfts)
+linear_to_mel_weight_matrix = tf.signal.linear_to_mel_weight_matrix(
+  num_mel_bins, stfts.shape[-1], SAMPLERATE, lower_edge_hertz, upper_edge_hertz)
+mel_spectrograms = tf.tensordot(spectrograms, linear_to_mel_weight_matrix, 1)
+log_mel_spectrograms = tf.math.log(mel_spectrograms + 1e-6)
+mfccs = tf.signal.mfccs_from_log_mel_spectrograms(log_mel_spectrograms)[..., :len(mcu_data["MFCCs"])]
+
+spectrum_ref = spectrograms.numpy().flatten()
+lms_ref = log_mel_spectrograms.numpy().flatten()
+mfccs_ref = mfccs.numpy().flatten()
+
+### Comparison
+# Bin 0 of arm_rfft_fast_f32 holds DC and Nyquist together, no mel band uses it
+passed = True
+if power_path:
+  spectrum = np.array(mcu_data["Power"])
+  spectrum_ref = np.square(spectrum_ref)
+  passed &= check("Power", np.max(np.abs(spectrum[1:] - spectrum_ref[1:])) / np.max(spectrum_ref), MAGNITUDE_TOL)
+  passed &= check("LMS", np.max(np.abs(np.array(mcu_data["LMS"]) - lms_ref)), POWER_LMS_TOL)
+else:
+  spectrum = np.array(mcu_data["Magnitude"])
+  passed &= check("Magnitude", np.max(np.abs(spectrum[1:] - spectrum_ref[1:])) / np.max(spectrum_ref), MAGNITUDE_TOL)
+  passed &= check("LMS", np.max(np.abs(np.array(mcu_data["LMS"]) - lms_ref)), LMS_TOL)
+  passed &= check("MFCCs", np.max(np.abs(np.array(mcu_data["MFCCs"]) - mfccs_ref)), MFCC_TOL)
+passed &= check("Int8", np.max(np.abs(np.array(mcu_data["Int8"]) - quantize(mfccs_ref))), POWER_INT8_TOL if power_path else INT8_TOL)
+
+print("PASSED" if passed else "FAILED")
+sys.exit(0 if passed else 1)
@@ -0,0 +1,93 @@
+/*
+ * kernel_bench_host.cpp
+ *
+ *  Runs the per-kernel microbenchmark of Core/Src/kernel_bench.cpp on the
+ *  host, for the model of MFCC21.h and the keyword benchmark model of TFLite,
+ *  and prints nanoseconds per Invoke(). On the target the same benchmark runs
+ *  at startup with KERNEL_BENCHMARK in main.cpp and reports cycles.
+ *
+ *  The kernels are built like for Tests/arena_sizer.cpp, the CMSIS-NN ones
+ *  with their DSP paths on the SIMD intrinsics of cmsis_host_dsp.h. The
+ *  absolute times say little about the Cortex-M4, compare kernels and shapes
+ *  with them. Set the variables and build the C sources as described there,
+ *  without -m32, then
+ */
+
+// K="../Core/Src/kernel_bench.cpp ../Core/Src/timing_scope.cpp $M/benchmarks/keyword_scrambled_model_data.cc"
+// g++ -O2 -DARM_MATH_DSP -include cmsis_host_dsp.h $I $X -o kernel_bench_host kernel_bench_host.cpp $K *.o $S
+// ./kernel_bench_host [rounds]
+
+#include <cstdio>
+#include <cstdlib>
+#include "MFCC21.h"
+#include "kernel_bench.h"
+#include "timing_scope.h"
+#include "tensorflow/lite/micro/benchmarks/keyword_scrambled_model_data.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
+
+#define ROUNDS 64
+#define MEMORY_SIZE (64 * 1024)
+
+// Debug log of TFLite, cortex_m_generic/debug_log.cc on the target
+extern "C" void DebugLog(const char* s){
+	fputs(s, stderr);
+}
+
+static void print_shape(const TfLiteIntArray* dims){
+	if(dims == nullptr){
+		printf("%-14s", "-");
+		return;
+	}
+	char text[32];
+	int length = 0;
+	for(int i = 0; i < dims->size && length < (int)sizeof(text) - 12; i++){
+		length += snprintf(&text[length], sizeof(text) - length, i > 0 ? "x%d" : "%d", dims->data[i]);
+	}
+	printf("%-14s", dims->size > 0 ? text : "scalar");
+}
+
+static void print_result(const struct KernelBenchResult* result){
+	printf("%3d %-16.16s ", result->node, result->op);
+	print_shape(result->input);
+	printf(" -> ");
+	print_shape(result->output);
+	if(result->status != kTfLiteOk || result->count == 0){
+		printf(" not benchmarked\n");
+		return;
+	}
+	printf(" %6u %10u %10u %10u\n", result->count, result->min,
+			(uint32_t)(result->sum / result->count), result->max);
+}
+
+static int bench(const char* name, const unsigned char* data, const tflite::MicroOpResolver& op_resolver,
+		int rounds, tflite::ErrorReporter* error_reporter){
+	static uint8_t memory[MEMORY_SIZE];
+	printf("%s\n%3s %-16s %-14s    %-14s %6s %10s %10s %10s\n", name, "op", "kernel", "input", "output",
+			"n", "min ns", "mean ns", "max ns");
+	return kernel_bench_model(tflite::GetModel(data), op_resolver, memory, MEMORY_SIZE, rounds,
+			error_reporter, print_result);
+}
+
+int main(int argc, char** argv){
+	int rounds = argc > 1 ? atoi(argv[1]) : ROUNDS;
+	static tflite::MicroErrorReporter micro_error_reporter;
+	init_cycle_count();
+
+	// The kernels of main.cpp and the ones of the keyword model
+	tflite::MicroMutableOpResolver<10> op_resolver;
+	if(op_resolver.AddFullyConnected() != kTfLiteOk || op_resolver.AddConv2D() != kTfLiteOk ||
+			op_resolver.AddMaxPool2D() != kTfLiteOk || op_resolver.AddMean() != kTfLiteOk ||
+			op_resolver.AddReshape() != kTfLiteOk || op_resolver.AddSoftmax() != kTfLiteOk ||
+			op_resolver.AddRelu() != kTfLiteOk || op_resolver.AddSvdf() != kTfLiteOk ||
+			op_resolver.AddQuantize() != kTfLiteOk || op_resolver.AddDequantize() != kTfLiteOk){
+		fprintf(stderr, "Could not add the ops\n");
+		return 1;
+	}
+
+	int failed = bench("MFCC21.h", MFCC, op_resolver, rounds, &micro_error_reporter);
+	printf("\n");
+	failed += bench("keyword_scrambled_model_data", g_keyword_scrambled_model_data, op_resolver, rounds,
+			&micro_error_reporter);
+	return failed > 0 ? 1 : 0;
+}
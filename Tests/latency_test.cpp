@@ -0,0 +1,121 @@
+/*
+ * latency_test.cpp
+ *
+ *  Unit test of the LATENCY_HISTOGRAM and LOW_LATENCY_CAPTURE bookkeeping
+ *  on the host: the bins of Core/Src/latency_histogram.cpp against the
+ *  exact percentiles of latencies up to LATENCY_SATURATION_MS in main.cpp,
+ *  and the torn block check of Core/Src/capture.cpp. Exits with 1 if a
+ *  check fails.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o latency_test \
+ *      latency_test.cpp ../Core/Src/latency_histogram.cpp ../Core/Src/capture.cpp
+ *  ./latency_test
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+#include "capture.h"
+#include "latency_histogram.h"
+
+#define SATURATION_MS 10000 // LATENCY_SATURATION_MS
+#define QUEUELENGTH 2048
+#define RESOLUTION 0.125 // Relative width of a bin above 16 ms
+
+static int failures = 0;
+
+static void check(bool ok, const char* what){
+	if(!ok){
+		printf("FAILED: %s\n", what);
+		failures++;
+	}
+}
+
+// Exact percentile as latency_percentile defines it
+static uint32_t exact_percentile(std::vector<uint32_t> values, uint32_t percent){
+	std::sort(values.begin(), values.end());
+	uint32_t target = (values.size() * percent + 99) / 100;
+	return values[target - 1];
+}
+
+static bool within_bin(uint32_t reported, uint32_t exact){
+	return reported >= exact && reported <= exact + (exact < 16 ? 0 : (uint32_t)(exact * RESOLUTION));
+}
+
+static void test_histogram(void){
+	// Superloop latencies of a few hundred ms to seconds, and short ones
+	const uint32_t centers[] = {3, 40, 215, 900, 4000, SATURATION_MS};
+	double worst = 0.0;
+	for(uint32_t center : centers){
+		struct LatencyHistogram histogram;
+		init_latency_histogram(&histogram);
+		std::vector<uint32_t> values;
+		uint32_t seed = center;
+		for(int i = 0; i < 1000; i++){
+			seed = seed * 1664525 + 1013904223;
+			uint32_t ms = center / 2 + (seed >> 8) % (center + 1);
+			ms = std::min<uint32_t>(ms, SATURATION_MS);
+			values.push_back(ms);
+			latency_record(&histogram, ms);
+		}
+		for(uint32_t percent : {50u, 90u, 100u}){
+			uint32_t exact = exact_percentile(values, percent);
+			uint32_t reported = latency_percentile(&histogram, percent);
+			worst = std::max(worst, (double)(reported - exact) / exact);
+			char what[80];
+			snprintf(what, sizeof(what), "p%u around %u ms: %u reported, %u exact", percent, center, reported, exact);
+			check(within_bin(reported, exact), what);
+		}
+	}
+	printf("percentiles at most %.1f%% above the exact ones\n", 100.0 * worst);
+
+	// Every latency in the range falls into a bin whose bounds contain it
+	struct LatencyHistogram histogram;
+	for(uint32_t ms = 0; ms < LATENCY_RANGE_MS; ms++){
+		init_latency_histogram(&histogram);
+		latency_record(&histogram, ms);
+		// max_ms caps the percentile, record a larger one to see the bin end
+		histogram.max_ms = UINT32_MAX;
+		uint32_t end = latency_percentile(&histogram, 100);
+		if(!within_bin(end, ms)){
+			char what[80];
+			snprintf(what, sizeof(what), "bin of %u ms ends at %u", ms, end);
+			check(false, what);
+			break;
+		}
+	}
+}
+
+static void test_capture_late(void){
+	static int32_t buffer[QUEUELENGTH];
+	struct Capture capture;
+	const int32_t* block;
+	init_capture(&capture, buffer, QUEUELENGTH);
+
+	capture_update(&capture, 0, QUEUELENGTH - 600);
+	uint16_t n = capture_next_block(&capture, 128, &block);
+	check(n == 600, "first block");
+	// The DMA moves on by less than the buffer while the block is processed
+	capture_update(&capture, 0, QUEUELENGTH - 1800);
+	check(!capture_check_late(&capture), "block intact");
+	capture_consume(&capture, n);
+
+	n = capture_next_block(&capture, 128, &block);
+	check(n == 1200, "second block");
+	// The DMA wraps around and reaches the start of the block at sample 600
+	capture_update(&capture, 1, QUEUELENGTH - 600);
+	check(!capture_check_late(&capture), "DMA right at the start of the block");
+	capture_update(&capture, 1, QUEUELENGTH - 601);
+	check(capture_check_late(&capture), "first sample of the block overwritten");
+	check(capture.overruns == 1, "torn block counted as overrun");
+	capture_consume(&capture, n);
+}
+
+int main(){
+	test_histogram();
+	test_capture_late();
+
+	printf(failures == 0 ? "PASSED\n" : "FAILED\n");
+	return failures == 0 ? 0 : 1;
+}
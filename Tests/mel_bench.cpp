@@ -0,0 +1,98 @@
+/*
+ * mel_bench.cpp
+ *
+ *  Compares calc_log_mel_spectrogram on the sparse flash table with the
+ *  routine it replaced, which built the 2008 entry float list on the stack
+ *  on every call. Reports ns per call, the deepest stack of each routine,
+ *  measured by running it on a painted stack of its own, and the largest
+ *  deviation of the log mel spectrogram.
+ *
+ *  The old routine is taken from the baseline commit:
+ *
+ *  git show 9a785f9:Core/Src/linear_to_mel_weight_list.cpp | \
+ *      sed 's/calc_log_mel_spectrogram/calc_log_mel_spectrogram_list/' > mel_list.cpp
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o mel_bench \
+ *      mel_bench.cpp mel_list.cpp cmsis_host_f32.cpp ../Core/Src/linear_to_mel_weight_list.cpp \
+ *      ../Core/Src/frontend_tables.cpp
+ *  ./mel_bench
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ucontext.h>
+#include "frontend_tables.h"
+#include "linear_to_mel_weight_list.h"
+
+#define CALLS 20000
+#define STACK_SIZE (64 * 1024)
+#define STACK_PAINT 0xC5
+
+void calc_log_mel_spectrogram_list(float32_t* magnitude, float32_t* log_mel_spectrogram);
+
+typedef void (*MelRoutine)(float32_t*, float32_t*);
+
+static float32_t magnitude[WINDOW_LENGTH / 2];
+static float32_t log_mel[N_MEL_BANDS];
+static MelRoutine measured;
+static ucontext_t main_context;
+
+static void run_measured(void){
+	measured(magnitude, log_mel);
+}
+
+// Deepest stack of one call in bytes
+static size_t stack_depth(MelRoutine routine){
+	static uint8_t stack[STACK_SIZE];
+	ucontext_t context;
+	memset(stack, STACK_PAINT, sizeof(stack));
+	getcontext(&context);
+	context.uc_stack.ss_sp = stack;
+	context.uc_stack.ss_size = sizeof(stack);
+	context.uc_link = &main_context;
+	makecontext(&context, run_measured, 0);
+	measured = routine;
+	swapcontext(&main_context, &context);
+
+	size_t untouched = 0;
+	while(untouched < sizeof(stack) && stack[untouched] == STACK_PAINT){
+		untouched++;
+	}
+	return sizeof(stack) - untouched;
+}
+
+static double ns_per_call(MelRoutine routine){
+	auto start = std::chrono::steady_clock::now();
+	for(int i = 0; i < CALLS; i++){
+		routine(magnitude, log_mel);
+	}
+	auto end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / CALLS;
+}
+
+int main(){
+	// Spectrum of a tone over a noise floor in the range of the DFSDM samples
+	uint32_t seed = 1;
+	for(int i = 0; i < WINDOW_LENGTH / 2; i++){
+		seed = seed * 1664525 + 1013904223;
+		magnitude[i] = 1000.0f * (seed >> 8) / (1 << 24) + (i == 60 ? 200000.0f : 0.0f);
+	}
+
+	float32_t reference[N_MEL_BANDS];
+	calc_log_mel_spectrogram_list(magnitude, reference);
+	calc_log_mel_spectrogram(magnitude, log_mel);
+	float32_t deviation = 0.0f;
+	for(int i = 0; i < N_MEL_BANDS; i++){
+		deviation = fmaxf(deviation, fabsf(log_mel[i] - reference[i]));
+	}
+
+	printf("%-8s %10s %10s\n", "routine", "ns/call", "stack B");
+	printf("%-8s %10.0f %10zu\n", "list", ns_per_call(calc_log_mel_spectrogram_list),
+			stack_depth(calc_log_mel_spectrogram_list));
+	printf("%-8s %10.0f %10zu\n", "sparse", ns_per_call(calc_log_mel_spectrogram),
+			stack_depth(calc_log_mel_spectrogram));
+	printf("max deviation %g\n", deviation);
+	return deviation < 1e-4f ? 0 : 1;
+}
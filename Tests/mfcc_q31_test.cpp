@@ -0,0 +1,140 @@
+/*
+ * mfcc_q31_test.cpp
+ *
+ *  Deviation of the integer-only front-end of FRONTEND_FIXED_POINT
+ *  (Core/Src/mfcc_q31.cpp) from the float32 one of calc_mfccs_f32 in
+ *  main.cpp, on the host. Checks log2_q16 against log2, log2_q16 and
+ *  dct2_int8 on the log mel spectrograms of the float path against
+ *  dct2_truncated_int8, and runs synthetic frames from silence to near full
+ *  scale through both front-ends. Exits with 1 if the int8 MFCCs differ by
+ *  more than the bounds below.
+ *
+ *  The FFT and magnitude of both paths are the stand-ins of
+ *  cmsis_host_f32.cpp and cmsis_host_q31.cpp, the per stage truncation of
+ *  the q31 library functions is not modelled. FRONTEND_COMPARE in main.cpp
+ *  reports the deviation with the library on the target.
+ *
+ *  M=../Middlewares/Third_Party/ARM_CMSIS/CMSIS
+ *  g++ -O2 -DARM_MATH_CM4 -I../Core/Inc -I$M/DSP/Include -I$M/Core/Include -o mfcc_q31_test \
+ *      mfcc_q31_test.cpp cmsis_host_f32.cpp cmsis_host_q31.cpp ../Core/Src/mfcc_q31.cpp \
+ *      ../Core/Src/frame_preprocess.cpp ../Core/Src/linear_to_mel_weight_list.cpp \
+ *      ../Core/Src/ben_dct2_f32.cpp ../Core/Src/frontend_tables.cpp
+ *  ./mfcc_q31_test
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include "ben_dct2_f32.h"
+#include "frame_preprocess.h"
+#include "frontend_tables.h"
+#include "linear_to_mel_weight_list.h"
+#include "mfcc_q31.h"
+
+#define FRAMES 400
+
+// Must match main.cpp
+#define FRAME_LENGTH WINDOW_LENGTH
+#define SAMPLINGRATE 9524
+#define PRE_EMPHASIS 0.0f
+
+// Tolerances
+#define LOG2_TOL 2e-4  // log2 units, the table has 32 linear segments per octave
+#define STAGE_TOL 1    // int8 steps, log2_q16 and dct2_int8
+#define FRONTEND_TOL 1 // int8 steps, whole front-end
+
+static int32_t samples[FRAME_LENGTH];
+static float32_t buffer1[FRAME_LENGTH];
+static float32_t buffer2[FRAME_LENGTH];
+static q31_t q31_buffer1[FRAME_LENGTH];
+static q31_t q31_buffer2[2 * FRAME_LENGTH];
+
+// Voiced frames over noise as 24 bit DFSDM words in the upper bits, the level
+// sweeps from 10 to 10^6 DFSDM units, frame 0 is silent
+static void synthesize_frame(int index){
+	static uint32_t seed = 1;
+	double pitch = 100.0 + 150.0 * (index % 17) / 16.0;
+	double level = (index == 0) ? 0.0 : pow(10.0, 1.0 + 5.0 * (index % 50) / 49.0);
+	int32_t dc = (index % 7 == 0) ? -(int32_t)(level / 2) : 0;
+	for(int i = 0; i < FRAME_LENGTH; i++){
+		double phase = 2.0 * M_PI * pitch * i / SAMPLINGRATE;
+		double x = 0.0;
+		for(int h = 1; h * pitch < SAMPLINGRATE / 2; h++){
+			double f = h * pitch;
+			double gain = 1.0 / (1.0 + pow((f - 700.0) / 150.0, 2)) + 0.5 / (1.0 + pow((f - 1800.0) / 250.0, 2));
+			x += gain * sin(h * phase + index);
+		}
+		seed = seed * 1664525 + 1013904223;
+		double noise = ((double)(seed >> 8) / (1 << 24) - 0.5) * 0.1;
+		samples[i] = (int32_t)(level * (0.5 * x + noise)) * 256 + dc * 256;
+	}
+}
+
+static void calc_mfccs_f32(int8_t* mfccs_int8, float32_t* log_mel, arm_rfft_fast_instance_f32* rfft_frame){
+	preprocess_frame_f32(samples, buffer1, FRAME_LENGTH, PRE_EMPHASIS, hann_window_f32);
+	arm_rfft_fast_f32(rfft_frame, buffer1, buffer2, 0);
+	arm_cmplx_mag_f32(buffer2, buffer1, FRAME_LENGTH/2);
+	calc_log_mel_spectrogram(buffer1, log_mel);
+	dct2_truncated_int8(log_mel, mfccs_int8);
+}
+
+static bool check(const char* name, double error, double tol){
+	bool ok = error <= tol;
+	printf("%-12s max error %g (tolerance %g) %s\n", name, error, tol, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+int main(){
+	bool passed = true;
+
+	double log2_error = 0.0;
+	for(uint64_t x = 1; x < (1ULL << 62); x = x * 3 / 2 + 1){
+		for(uint64_t y = x; y < x + 64; y++){
+			log2_error = fmax(log2_error, fabs(log2_q16(y) / 65536.0 - log2((double)y)));
+		}
+	}
+	passed &= check("log2_q16", log2_error, LOG2_TOL);
+
+	arm_rfft_fast_instance_f32 rfft_frame;
+	arm_rfft_fast_init_f32(&rfft_frame, FRAME_LENGTH);
+	struct MfccQ31 mfcc_q31;
+	if(init_mfcc_q31(&mfcc_q31, FRAME_LENGTH, (q15_t)(PRE_EMPHASIS * 32768), hann_window_q15) != ARM_MATH_SUCCESS){
+		printf("init_mfcc_q31 failed\n");
+		return 1;
+	}
+
+	int stage_deviation = 0;
+	int frontend_deviation = 0;
+	int histogram[3] = {0}; // Coefficients that differ by 0, 1 and more steps
+	for(int index = 0; index < FRAMES; index++){
+		synthesize_frame(index);
+		float32_t log_mel[N_MEL_BANDS];
+		int8_t mfccs_f32[N_MFCC_COEFFS];
+		calc_mfccs_f32(mfccs_f32, log_mel, &rfft_frame);
+
+		int32_t log2_mel_q16[N_MEL_BANDS];
+		int8_t mfccs_stage[N_MFCC_COEFFS];
+		for(int i = 0; i < N_MEL_BANDS; i++){
+			log2_mel_q16[i] = (int32_t)lrint(log_mel[i] / M_LN2 * 65536.0);
+		}
+		dct2_int8(log2_mel_q16, mfccs_stage);
+
+		int8_t mfccs_q31[N_MFCC_COEFFS];
+		calc_mfccs_q31(&mfcc_q31, samples, q31_buffer1, q31_buffer2, mfccs_q31);
+
+		for(int k = 0; k < N_MFCC_COEFFS; k++){
+			int d = abs(mfccs_q31[k] - mfccs_f32[k]);
+			stage_deviation = std::max(stage_deviation, abs(mfccs_stage[k] - mfccs_f32[k]));
+			frontend_deviation = std::max(frontend_deviation, d);
+			histogram[std::min(d, 2)]++;
+		}
+	}
+	passed &= check("log2 + dct", stage_deviation, STAGE_TOL);
+	passed &= check("front-end", frontend_deviation, FRONTEND_TOL);
+	printf("%d coefficients: %d equal, %d one step, %d more\n", FRAMES * N_MFCC_COEFFS,
+			histogram[0], histogram[1], histogram[2]);
+
+	printf(passed ? "PASSED\n" : "FAILED\n");
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+import numpy as np
+import pandas as pd
+import tensorflow as tf
+import matplotlib.pyplot as plt
+
+# Accuracy of the power spectrum front-end (FRONTEND_POWER_SPECTRUM in main.cpp)
+# against the tensorflow reference of mfcc.py. The audio is an MCU log as for
+# mfcc.py, the reference uses magnitudes and the exact log, the approximation
+# mirrors calc_log_mel_spectrogram_power and fast_log2_f32.
+
+INPUT = "MFCC/test02/test01"
+SAMPLERATE = 9524
+
+INPUT_SCALE = 0.003135847859084606
+INPUT_ZERO_POINT = -128
+
+# Coefficients of fast_log2_f32
+LOG2_A = 0.42286532
+LOG2_B = -0.15922010
+
+
+def fast_log2(x):
+  x = x.astype(np.float32)
+  bits = x.view(np.uint32)
+  exponent = (bits >> 23).astype(np.int32) - 127
+  t = ((bits & 0x007FFFFF) | 0x3F800000).view(np.float32) - 1.0
+  return exponent + t * (1.0 + (1.0 - t) * (LOG2_A + LOG2_B * t))
+
+
+def quantize(mfccs):
+  # normalize_mfccs in main.cpp
+  return np.trunc((mfccs / 512 + 0.5) / INPUT_SCALE + INPUT_ZERO_POINT).clip(-128, 127)
+
+
+# Read in the audio, every non numeric item is a marker or noise
+raw = pd.read_csv(INPUT + ".log", header=None, encoding='unicode_escape')
+
+audio = []
+noisy_items = 0
+for item in list(raw[0]):
+  try:
+    audio.append(float(item))
+  except ValueError:
+    noisy_items += 1
+
+print("Num noisy items: {}".format(noisy_items))
+
+audio = np.array(audio).astype(np.float32)
+
+### Reference as in mfcc.py
+sample_rate = 9524.0
+lower_edge_hertz, upper_edge_hertz, num_mel_bins = 80.0, 4700.0, 64
+frame_length = 1024
+
+stfts = tf.signal.stft(tf.convert_to_tensor(audio[np.newaxis, ...]), frame_length, frame_length, frame_length)[:,:,:-1]
+num_spectrogram_bins = stfts.shape[-1]
+linear_to_mel_weight_matrix = tf.signal.linear_to_mel_weight_matrix(
+  num_mel_bins, num_spectrogram_bins, sample_rate, lower_edge_hertz,
+  upper_edge_hertz)
+
+mel_spectrograms = tf.tensordot(tf.abs(stfts), linear_to_mel_weight_matrix, 1)
+log_mel_ref = tf.math.log(mel_spectrograms + 1e-6).numpy()
+mfccs_ref = tf.signal.mfccs_from_log_mel_spectrograms(log_mel_ref).numpy()[..., :13]
+
+### Power spectrum path
+weights = linear_to_mel_weight_matrix.numpy()
+offsets = 0.5 * np.log(np.sum(weights, axis=0)).astype(np.float32)
+power = np.square(np.abs(stfts.numpy())).astype(np.float32)
+mel_power = np.tensordot(power, weights, 1) + 1e-12
+log_mel_pow = 0.34657359 * fast_log2(mel_power) + offsets
+mfccs_pow = tf.signal.mfccs_from_log_mel_spectrograms(log_mel_pow).numpy()[..., :13]
+
+x = np.linspace(1e-6, 1e6, 1000000).astype(np.float32)
+print("fast_log2 max abs error: {:.6f}".format(np.max(np.abs(fast_log2(x) - np.log2(x)))))
+
+log_mel_err = np.abs(log_mel_pow - log_mel_ref)
+mfcc_err = np.abs(mfccs_pow - mfccs_ref)
+int8_err = np.abs(quantize(mfccs_pow) - quantize(mfccs_ref))
+print("Log mel error: max {:.4f}, mean {:.4f}".format(np.max(log_mel_err), np.mean(log_mel_err)))
+print("MFCC error: max {:.4f}, mean {:.4f}".format(np.max(mfcc_err), np.mean(mfcc_err)))
+print("int8 error: max {:.0f}, mean {:.4f}, rows {}".format(np.max(int8_err), np.mean(int8_err), int8_err.shape[1]))
+for k in range(13):
+  print("  mfcc {:2d}: max {:.0f} mean {:.3f}".format(k, np.max(int8_err[..., k]), np.mean(int8_err[..., k])))
+
+
+# Plotting
+fig, (ax1, ax2) = plt.subplots(nrows=2, ncols=1, sharex=False)
+
+fig.set_figheight(10)
+fig.set_figwidth(20)
+
+# LMS
+ax1.plot(log_mel_ref.flatten(), color="red")
+ax1.plot(log_mel_pow.flatten(), color="blue")
+ax1.set_ylabel("LMS", fontsize=10)
+
+# int8 MFCCs
+ax2.plot(quantize(mfccs_ref).flatten(), color="red")
+ax2.plot(quantize(mfccs_pow).flatten(), color="blue")
+ax2.set_xlabel("sample", fontsize=18)
+ax2.set_ylabel("int8 MFCCs", fontsize=10)
+
+plt.tight_layout()
+plt.show()
@@ -0,0 +1,120 @@
+import sys
+
+# Discrete event simulation of the two execution models in main.cpp. The DMA
+# completes one half of RecBuff every HALF_PERIOD, the DMA callback pushes a
+# descriptor into the frame queue (FRAME_QUEUE_LENGTH entries). A half has to be
+# processed before the DMA returns to it, one HALF_PERIOD after it completed,
+# otherwise it is counted as late (frame_queue_check_late).
+#
+# superloop: process_audio runs between two inferences in the main loop
+# deferred:  process_audio runs in PendSV as soon as a half completes and
+#            preempts the inference (DEFERRED_FRONTEND)
+#
+# Exits with 1 if the deferred model loses a frame in any configuration.
+
+SAMPLINGRATE = 9524
+HALF_LENGTH = 1024
+HALF_PERIOD = HALF_LENGTH / SAMPLINGRATE
+FRAME_QUEUE_LENGTH = 4
+
+DURATION = 60.0 # seconds of simulated audio
+FRONTEND_TIMES = [0.005, 0.015, 0.030] # seconds per half
+INFERENCE_TIMES = [0.050, 0.100, 0.150, 0.250, 0.400] # seconds per inference
+
+
+def half_times():
+  n = int(DURATION / HALF_PERIOD)
+  return [(k + 1) * HALF_PERIOD for k in range(n)]
+
+
+def simulate_superloop(frontend_time, inference_time):
+  halves = half_times()
+  queue = []
+  processed = late = overruns = inferences = 0
+  t = 0.0
+  next_half = 0
+
+  def push_until(time):
+    nonlocal next_half, overruns
+    while next_half < len(halves) and halves[next_half] <= time:
+      if len(queue) == FRAME_QUEUE_LENGTH:
+        overruns += 1
+      else:
+        queue.append(halves[next_half])
+      next_half += 1
+
+  while t < DURATION:
+    push_until(t)
+    while queue:
+      ready = queue.pop(0)
+      if t >= ready + HALF_PERIOD:
+        late += 1
+        continue
+      t += frontend_time
+      processed += 1
+      push_until(t)
+
+    # The main loop always finds a new row to run the model on
+    if processed > 0:
+      t += inference_time
+      inferences += 1
+    elif next_half < len(halves):
+      t = halves[next_half]
+    else:
+      break
+
+  return processed, late, overruns, inferences
+
+
+def simulate_deferred(frontend_time, inference_time):
+  halves = half_times()
+  processed = late = inferences = 0
+  busy_until = 0.0
+
+  # The front-end runs at the completion of every half unless the previous one is still running
+  frontend_end = []
+  for ready in halves:
+    start = max(ready, busy_until)
+    if start >= ready + HALF_PERIOD:
+      late += 1
+      continue
+    busy_until = start + frontend_time
+    frontend_end.append((start, busy_until))
+    processed += 1
+
+  # The inference only gets the time the front-end leaves over
+  t = frontend_end[0][1] if frontend_end else DURATION
+  i = 0
+  while t < DURATION:
+    remaining = inference_time
+    while remaining > 0:
+      while i < len(frontend_end) and frontend_end[i][1] <= t:
+        i += 1
+      if i < len(frontend_end) and frontend_end[i][0] <= t:
+        t = frontend_end[i][1]
+        continue
+      next_start = frontend_end[i][0] if i < len(frontend_end) else float('inf')
+      step = min(remaining, next_start - t)
+      t += step
+      remaining -= step
+    if t <= DURATION:
+      inferences += 1
+
+  return processed, late, 0, inferences
+
+
+print("Half period {:.1f} ms, {} halves".format(HALF_PERIOD * 1000, len(half_times())))
+print("{:>8s} {:>8s} | {:>30s} | {:>30s}".format("FE ms", "inf ms", "superloop proc/late/ovr/inf", "deferred proc/late/ovr/inf"))
+
+lossless = True
+for frontend_time in FRONTEND_TIMES:
+  for inference_time in INFERENCE_TIMES:
+    superloop = simulate_superloop(frontend_time, inference_time)
+    deferred = simulate_deferred(frontend_time, inference_time)
+    if deferred[1] > 0 or deferred[2] > 0:
+      lossless = False
+    print("{:8.1f} {:8.1f} | {:>30s} | {:>30s}".format(frontend_time * 1000, inference_time * 1000,
+          "{}/{}/{}/{}".format(*superloop), "{}/{}/{}/{}".format(*deferred)))
+
+print("Deferred front-end without lost frames: {}".format("yes" if lossless else "NO"))
+sys.exit(0 if lossless else 1)
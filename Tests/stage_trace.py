@@ -0,0 +1,119 @@
+import struct
+import sys
+
+# Evaluates a dump of the stage trace (STAGE_TRACE in main.cpp,
+# Core/Inc/stage_trace.h). Capture the UART, e.g. with cat /dev/ttyACM0 >
+# Trace/capture.bin, and request a dump with echo -n T > /dev/ttyACM0. The
+# last dump in the capture is used, text around it is ignored. Prints min,
+# mean, p99 and max per stage in microseconds:
+#   dma wait      DMA callback of the half holding the newest sample of a frame
+#                 until the front-end starts the frame. With LOW_LATENCY_CAPTURE
+#                 frames can start before that callback, they have no dma wait
+#                 and no end to end time.
+#   preprocess .. dct   stages of the float32 front-end (calc_mfccs_f32)
+#   frontend      frame start until its row is in the ring buffer
+#   queue         newest row until the inference starts
+#   staging, invoke, decision   steps of the inference
+#   end to end    DMA callback of the newest row until the decision
+
+INPUT = "Trace/capture.bin"
+
+# Must match stage_trace.h
+MAGIC = 0x45435254
+STAGES = ["dma", "frame", "preprocess", "fft", "magnitude", "mel", "dct", "row",
+          "inference", "staging", "invoke", "decision"]
+EVENT_SIZE = 8
+HEADER_SIZE = 16
+
+
+def read_dump(data):
+  pos = data.rfind(struct.pack("<I", MAGIC))
+  while pos >= 0:
+    if pos + HEADER_SIZE <= len(data):
+      _, written, capacity, timer_hz = struct.unpack("<4I", data[pos:pos + HEADER_SIZE])
+      end = pos + HEADER_SIZE + capacity * EVENT_SIZE
+      if 0 < capacity <= 65536 and end <= len(data):
+        events = [struct.unpack("<IHBB", data[i:i + EVENT_SIZE])[:3]
+                  for i in range(pos + HEADER_SIZE, end, EVENT_SIZE)]
+        if written <= capacity:
+          events = events[:written]
+        else:
+          start = written % capacity
+          events = events[start:] + events[:start]
+        return events, written, timer_hz
+    pos = data.rfind(struct.pack("<I", MAGIC), 0, pos)
+  sys.exit("No complete trace dump in " + INPUT)
+
+
+def unwrap(events):
+  # The timer wraps after 2^32 cycles, about 54 s at 80 MHz
+  out = []
+  offset = 0
+  last = None
+  for timestamp, id, stage in events:
+    if last is not None and timestamp < last:
+      offset += 1 << 32
+    last = timestamp
+    out.append((timestamp + offset, id, STAGES[stage] if stage < len(STAGES) else str(stage)))
+  return out
+
+
+def analyse(events):
+  durations = {}
+
+  def add(name, cycles):
+    durations.setdefault(name, []).append(cycles)
+
+  dma = {}            # Half id -> time of its DMA callback
+  frame = None        # (id, start, dma, time of the previous stage)
+  newest_row = None   # (time, dma)
+  inference = None    # (id, start, time of the previous step, dma of the newest row)
+  for t, id, stage in events:
+    if stage == "dma":
+      dma[id] = t
+    elif stage == "frame":
+      # Frames and DMA events carry the same half id
+      dma_time = dma.get(id)
+      if dma_time is not None:
+        add("dma wait", t - dma_time)
+      frame = (id, t, dma_time, t)
+    elif stage in ("preprocess", "fft", "magnitude", "mel", "dct"):
+      if frame is not None and frame[0] == id:
+        add(stage, t - frame[3])
+        frame = (frame[0], frame[1], frame[2], t)
+    elif stage == "row":
+      if frame is not None and frame[0] == id:
+        add("frontend", t - frame[1])
+        newest_row = (t, frame[2])
+      frame = None
+    elif stage == "inference":
+      if newest_row is not None:
+        add("queue", t - newest_row[0])
+      inference = (id, t, t, newest_row[1] if newest_row is not None else None)
+    elif stage in ("staging", "invoke", "decision"):
+      if inference is not None and inference[0] == id:
+        add(stage, t - inference[2])
+        inference = (inference[0], inference[1], t, inference[3])
+        if stage == "decision":
+          if inference[3] is not None:
+            add("end to end", t - inference[3])
+          inference = None
+  return durations
+
+
+events, written, timer_hz = read_dump(open(INPUT if len(sys.argv) < 2 else sys.argv[1], "rb").read())
+print("{} events of {} recorded, {:.1f} ms".format(
+  len(events), written, (events[-1][0] - events[0][0]) % (1 << 32) * 1e3 / timer_hz if events else 0))
+
+durations = analyse(unwrap(events))
+order = ["dma wait", "preprocess", "fft", "magnitude", "mel", "dct", "frontend",
+         "queue", "staging", "invoke", "decision", "end to end"]
+print("{:<12} {:>6} {:>10} {:>10} {:>10} {:>10}".format("stage", "n", "min us", "mean us", "p99 us", "max us"))
+for name in order:
+  if name not in durations:
+    continue
+  values = sorted(durations[name])
+  us = [v * 1e6 / timer_hz for v in values]
+  p99 = us[min(len(us) - 1, (len(us) * 99 + 99) // 100 - 1)]
+  print("{:<12} {:>6} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}".format(
+    name, len(us), us[0], sum(us) / len(us), p99, us[-1]))
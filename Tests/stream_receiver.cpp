@@ -0,0 +1,262 @@
+/*
+ * stream_receiver.cpp
+ *
+ *  Host side of FEATURE_STREAM (Core/Inc/feature_stream.h). Reads the UART,
+ *  or a raw capture of it, checks the records and appends one fixed size
+ *  slot per frame to a capture file that can be memory mapped, e.g.
+ *
+ *    slot = np.dtype([("sequence", "<u4"), ("flags", "<u2"), ("stages", "<u2"),
+ *                     ("audio", "<i2", 1024), ("spectrum", "<f4", 512),
+ *                     ("lms", "<f4", 64), ("mfcc", "<f4", 13), ("int8", "i1", 16)])
+ *    frames = np.memmap("session.cap", dtype=slot, mode="r", offset=64)
+ *
+ *  stages is the mask of the sections the record had, the others are zero.
+ *  Missing sequence numbers are records the board dropped or that arrived
+ *  corrupted, they are counted on exit. Everything outside of records, i.e.
+ *  the text or tokenized log, goes to <capture>.log for Tests/token_decoder.py.
+ *
+ *  g++ -O2 -o stream_receiver stream_receiver.cpp
+ *  ./stream_receiver /dev/ttyACM0 session.cap [baudrate]
+ */
+
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// Must match feature_stream.h and main.cpp
+#define STREAM_MAGIC 0x4D525453
+#define HEADER_SIZE 12
+#define MAX_PAYLOAD 4608
+#define FRAME_LENGTH 1024
+#define N_MEL_BANDS 64
+#define N_MFCC 13
+
+enum Stage { STREAM_AUDIO, STREAM_SPECTRUM, STREAM_LMS, STREAM_MFCC, STREAM_INT8, STREAM_STAGES };
+enum Type { STREAM_TYPE_INT8, STREAM_TYPE_INT16, STREAM_TYPE_FLOAT32 };
+
+struct FileHeader {
+	char magic[8];          // "FSTREAM1"
+	uint32_t header_size;
+	uint32_t slot_size;
+	uint32_t frame_length;
+	uint32_t spectrum_length;
+	uint32_t mel_bands;
+	uint32_t mfccs;
+	uint8_t reserved[32];
+};
+
+struct Slot {
+	uint32_t sequence;
+	uint16_t flags;
+	uint16_t stages;
+	int16_t audio[FRAME_LENGTH];
+	float spectrum[FRAME_LENGTH / 2];
+	float lms[N_MEL_BANDS];
+	float mfcc[N_MFCC];
+	int8_t int8[16];        // N_MFCC padded to 4 bytes
+};
+
+static_assert(sizeof(FileHeader) == 64, "the file header is 64 bytes");
+static_assert(sizeof(Slot) == 8 + 2 * FRAME_LENGTH + 4 * (FRAME_LENGTH / 2 + N_MEL_BANDS + N_MFCC) + 16,
+		"slots have no padding");
+
+static volatile sig_atomic_t stop = 0;
+
+static void on_signal(int){
+	stop = 1;
+}
+
+static uint32_t get_u16(const uint8_t* data){
+	return data[0] | (data[1] << 8);
+}
+
+static uint32_t get_u32(const uint8_t* data){
+	return get_u16(data) | (get_u16(&data[2]) << 16);
+}
+
+static uint32_t crc32(const uint8_t* data, size_t length){
+	uint32_t crc = 0xFFFFFFFF;
+	for(size_t i = 0; i < length; i++){
+		crc ^= data[i];
+		for(int bit = 0; bit < 8; bit++){
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+		}
+	}
+	return ~crc;
+}
+
+static speed_t baud_constant(long baudrate){
+	switch(baudrate){
+	case 115200: return B115200;
+	case 230400: return B230400;
+#ifdef B460800
+	case 460800: return B460800;
+#endif
+#ifdef B921600
+	case 921600: return B921600;
+#endif
+#ifdef B2000000
+	case 2000000: return B2000000;
+#endif
+	default: return 0;
+	}
+}
+
+static bool configure_tty(int fd, long baudrate){
+	struct termios tty;
+	if(tcgetattr(fd, &tty) != 0){
+		return false;
+	}
+	speed_t speed = baud_constant(baudrate);
+	if(speed == 0){
+		fprintf(stderr, "Unsupported baud rate %ld\n", baudrate);
+		return false;
+	}
+	cfmakeraw(&tty);
+	cfsetispeed(&tty, speed);
+	cfsetospeed(&tty, speed);
+	tty.c_cflag |= CLOCAL | CREAD;
+	tty.c_cc[VMIN] = 1;
+	tty.c_cc[VTIME] = 0;
+	return tcsetattr(fd, TCSANOW, &tty) == 0;
+}
+
+// Copies the sections of a checked record into a slot, false if one does not fit
+static bool fill_slot(const uint8_t* record, Slot* slot){
+	memset(slot, 0, sizeof(*slot));
+	slot->sequence = get_u32(&record[4]);
+	slot->flags = get_u16(&record[8]);
+	const uint8_t* section = &record[HEADER_SIZE];
+	const uint8_t* end = section + get_u16(&record[10]);
+	while(section + 4 <= end){
+		uint32_t stage = section[0];
+		uint32_t type = section[1];
+		uint32_t count = get_u16(&section[2]);
+		uint32_t size = count * (type == STREAM_TYPE_FLOAT32 ? 4 : type == STREAM_TYPE_INT16 ? 2 : 1);
+		const uint8_t* values = &section[4];
+		if(values + size > end){
+			return false;
+		}
+		if(stage == STREAM_AUDIO && type == STREAM_TYPE_INT16 && count == FRAME_LENGTH){
+			memcpy(slot->audio, values, size);
+		} else if(stage == STREAM_SPECTRUM && type == STREAM_TYPE_FLOAT32 && count == FRAME_LENGTH / 2){
+			memcpy(slot->spectrum, values, size);
+		} else if(stage == STREAM_LMS && type == STREAM_TYPE_FLOAT32 && count == N_MEL_BANDS){
+			memcpy(slot->lms, values, size);
+		} else if(stage == STREAM_MFCC && type == STREAM_TYPE_FLOAT32 && count == N_MFCC){
+			memcpy(slot->mfcc, values, size);
+		} else if(stage == STREAM_INT8 && type == STREAM_TYPE_INT8 && count == N_MFCC){
+			memcpy(slot->int8, values, size);
+		} else {
+			return false;
+		}
+		slot->stages |= 1u << stage;
+		section = values + size;
+	}
+	return section == end;
+}
+
+int main(int argc, char** argv){
+	if(argc < 3){
+		fprintf(stderr, "usage: %s <tty or raw capture> <capture file> [baudrate]\n", argv[0]);
+		return 2;
+	}
+	long baudrate = argc > 3 ? atol(argv[3]) : 921600;
+
+	int fd = open(argv[1], O_RDONLY | O_NOCTTY);
+	if(fd < 0){
+		perror(argv[1]);
+		return 1;
+	}
+	if(isatty(fd) && !configure_tty(fd, baudrate)){
+		fprintf(stderr, "Could not configure %s\n", argv[1]);
+		return 1;
+	}
+	FILE* out = fopen(argv[2], "wb");
+	std::string log_path = std::string(argv[2]) + ".log";
+	FILE* log = fopen(log_path.c_str(), "wb");
+	if(out == nullptr || log == nullptr){
+		perror("fopen");
+		return 1;
+	}
+
+	FileHeader header = {};
+	memcpy(header.magic, "FSTREAM1", 8);
+	header.header_size = sizeof(FileHeader);
+	header.slot_size = sizeof(Slot);
+	header.frame_length = FRAME_LENGTH;
+	header.spectrum_length = FRAME_LENGTH / 2;
+	header.mel_bands = N_MEL_BANDS;
+	header.mfccs = N_MFCC;
+	fwrite(&header, sizeof(header), 1, out);
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+
+	std::vector<uint8_t> data;
+	uint8_t chunk[4096];
+	Slot slot;
+	uint32_t records = 0, corrupted = 0, missing = 0, discontinuities = 0;
+	uint32_t next_sequence = 0;
+	while(!stop){
+		ssize_t n = read(fd, chunk, sizeof(chunk));
+		if(n <= 0){
+			break;
+		}
+		data.insert(data.end(), chunk, chunk + n);
+
+		size_t pos = 0;
+		while(data.size() - pos >= 4){
+			if(get_u32(&data[pos]) != STREAM_MAGIC){
+				fputc(data[pos++], log);
+				continue;
+			}
+			if(data.size() - pos < HEADER_SIZE){
+				break;
+			}
+			uint32_t length = get_u16(&data[pos + 10]);
+			if(length > MAX_PAYLOAD){
+				fputc(data[pos++], log);
+				continue;
+			}
+			if(data.size() - pos < HEADER_SIZE + length + 4){
+				break;
+			}
+			const uint8_t* record = &data[pos];
+			if(crc32(record, HEADER_SIZE + length) != get_u32(&record[HEADER_SIZE + length]) ||
+					!fill_slot(record, &slot)){
+				// Text that happens to contain the magic or a record with lost bytes
+				corrupted++;
+				fputc(data[pos++], log);
+				continue;
+			}
+			if(records > 0 && slot.sequence != next_sequence){
+				missing += slot.sequence - next_sequence;
+			}
+			next_sequence = slot.sequence + 1;
+			discontinuities += (slot.flags & 1);
+			fwrite(&slot, sizeof(slot), 1, out);
+			records++;
+			pos += HEADER_SIZE + length + 4;
+		}
+		data.erase(data.begin(), data.begin() + pos);
+		if(records % 100 == 0){
+			fflush(out);
+		}
+	}
+
+	fwrite(data.data(), 1, data.size(), log);
+	fclose(out);
+	fclose(log);
+	close(fd);
+	fprintf(stderr, "%u records, %u missing, %u corrupted, %u with lost audio before them\n",
+			records, missing, corrupted, discontinuities);
+	return 0;
+}
@@ -0,0 +1,123 @@
+import random
+import sys
+
+# Checks the row bookkeeping of streaming_head.cpp against a full evaluation of
+# the first two layers of the model, 3x3 convolutions with SAME padding and
+# strides 1 and 2 as in MFCCTraining.py. Integer weights without requantization,
+# so any difference comes from the indexing. The window slides by random hops,
+# including odd ones and jumps beyond the cache. Exits with 1 on a mismatch.
+
+WINDOW_ROWS = 93 # BUFFERSIZE
+WIDTH = 13 # N_MFCC
+CHANNELS1 = 3
+CHANNELS2 = 4
+STREAM_HISTORY = 96
+HOPS = [1, 2, 2, 2, 3, 5, 20, 50, 100]
+
+random.seed(1)
+filter1 = [[[random.randint(-3, 3) for _ in range(3)] for _ in range(3)] for _ in range(CHANNELS1)]
+filter2 = [[[[random.randint(-3, 3) for _ in range(CHANNELS1)] for _ in range(3)] for _ in range(3)] for _ in range(CHANNELS2)]
+
+
+def same_padding(in_size, stride):
+  # Output size and padding before the first element as in tf 'same'
+  out_size = (in_size + stride - 1) // stride
+  return out_size, max((out_size - 1) * stride + 3 - in_size, 0) // 2
+
+
+def conv_row1(rows):
+  # rows: three input rows, None for padding, the output is a flat row as in rows1
+  out_width, pad_left = same_padding(WIDTH, 1)
+  out = []
+  for x in range(out_width):
+    for c in range(CHANNELS1):
+      acc = 0
+      for ky in range(3):
+        if rows[ky] is None:
+          continue
+        for kx in range(3):
+          in_x = x - pad_left + kx
+          if 0 <= in_x < WIDTH:
+            acc += filter1[c][ky][kx] * rows[ky][in_x]
+      out.append(max(acc, 0))
+  return out
+
+
+def conv_row2(rows):
+  out_width, pad_left = same_padding(WIDTH, 2)
+  out = []
+  for x in range(out_width):
+    for c in range(CHANNELS2):
+      acc = 0
+      for ky in range(3):
+        if rows[ky] is None:
+          continue
+        for kx in range(3):
+          in_x = 2 * x - pad_left + kx
+          if 0 <= in_x < WIDTH:
+            for ic in range(CHANNELS1):
+              acc += filter2[c][ky][kx][ic] * rows[ky][in_x * CHANNELS1 + ic]
+      out.append(acc)
+  return out
+
+
+def full(window):
+  n = len(window)
+  layer1 = [conv_row1([window[r - 1] if r > 0 else None, window[r], window[r + 1] if r < n - 1 else None])
+            for r in range(n)]
+  out_rows, pad_top = same_padding(n, 2)
+  layer2 = []
+  for j in range(out_rows):
+    rows = [layer1[2 * j - pad_top + ky] if 0 <= 2 * j - pad_top + ky < n else None for ky in range(3)]
+    layer2.append(conv_row2(rows))
+  return layer2
+
+
+class StreamingHead:
+  # Mirrors streaming_head_update and streaming_conv_invoke
+  def __init__(self):
+    self.rows1 = [None] * STREAM_HISTORY
+    self.rows2 = [None] * STREAM_HISTORY
+    self.rows1_end = 0
+    self.rows2_end = 0
+
+  def update(self, window, rows_inserted):
+    n = WINDOW_ROWS
+    s = rows_inserted - n
+    if self.rows1_end < s + 1 or self.rows1_end > s + n - 1:
+      self.rows1_end = s + 1
+    while self.rows1_end < s + n - 1:
+      r = self.rows1_end - s
+      self.rows1[self.rows1_end % STREAM_HISTORY] = conv_row1(window[r - 1:r + 2])
+      self.rows1_end += 1
+
+    if self.rows2_end < s + 2 or self.rows2_end > s + n - 2:
+      self.rows2_end = s + 2
+    while self.rows2_end < s + n - 2:
+      c = self.rows2_end
+      self.rows2[c % STREAM_HISTORY] = conv_row2([self.rows1[(c + k) % STREAM_HISTORY] for k in (-1, 0, 1)])
+      self.rows2_end += 1
+
+    edge1 = [conv_row1([None, window[0], window[1]]), conv_row1([window[n - 2], window[n - 1], None])]
+    edge2 = [conv_row2([None, edge1[0], self.rows1[(s + 1) % STREAM_HISTORY]]),
+             conv_row2([self.rows1[(s + n - 2) % STREAM_HISTORY], edge1[1], None])]
+    out_rows = (n + 1) // 2
+    return [edge2[0]] + [self.rows2[(s + 2 * j) % STREAM_HISTORY] for j in range(1, out_rows - 1)] + [edge2[1]]
+
+
+rows = [[random.randint(-5, 5) for _ in range(WIDTH)] for _ in range(3000)]
+head = StreamingHead()
+rows_inserted = WINDOW_ROWS
+windows = 0
+passed = True
+while rows_inserted <= len(rows):
+  window = rows[rows_inserted - WINDOW_ROWS:rows_inserted]
+  if head.update(window, rows_inserted) != full(window):
+    print("Mismatch after {} rows".format(rows_inserted))
+    passed = False
+    break
+  rows_inserted += random.choice(HOPS)
+  windows += 1
+
+print("{} windows {}".format(windows, "PASSED" if passed else "FAILED"))
+sys.exit(0 if passed else 1)
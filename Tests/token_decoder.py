@@ -0,0 +1,129 @@
+import re
+import struct
+import sys
+
+# Turns a UART capture of a board built with TOKENIZED_LOG back into text. The
+# packets are described in Core/Inc/token_log.h, the format strings are read
+# from Core/Inc/log_tokens.h. Bytes outside of packets, e.g. the benchmark
+# reports which are still sent as text, are passed through unchanged. Messages
+# of the TFLite error reporter only carry the flash addresses of their format
+# string and %s arguments, they are resolved from the ELF file of the firmware
+# (needs pyelftools). Capture with e.g. cat /dev/ttyACM0 > Tokens/capture.bin
+# and pass another capture or ELF file as arguments if needed.
+
+INPUT = "Tokens/capture.bin"
+ELF = "../Debug/MLoMCFinalProject.elf"
+TOKENS_HEADER = "../Core/Inc/log_tokens.h"
+
+# Must match token_log.h
+SYNC = 0xA5
+FORMAT_TOKEN = 0xFF
+MAX_ARGS = 8
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?([hlLzjt]*)([diouxXcsfFeEgGaAp%])")
+
+
+def read_tokens(path):
+  text = open(path).read()
+  entries = re.findall(r'X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)', text)
+  return [(name, fmt.encode().decode("unicode_escape")) for name, fmt in entries]
+
+
+class Elf:
+  def __init__(self, path):
+    self.sections = []
+    try:
+      from elftools.elf.elffile import ELFFile
+      elf = ELFFile(open(path, "rb"))
+      for section in elf.iter_sections():
+        if section["sh_type"] == "SHT_PROGBITS" and section["sh_addr"] != 0:
+          self.sections.append((section["sh_addr"], section.data()))
+    except (ImportError, OSError) as e:
+      print("No ELF file, error reporter messages stay undecoded (%s)" % e, file=sys.stderr)
+
+  def string(self, address):
+    for start, data in self.sections:
+      if start <= address < start + len(data):
+        end = data.index(b"\0", address - start)
+        return data[address - start:end].decode(errors="replace")
+    return None
+
+
+def format_args(fmt, raw, elf):
+  # Converts the raw words in the order the target packed them
+  out = []
+  values = list(raw)
+  pos = 0
+  for m in CONVERSION.finditer(fmt):
+    flags, width, precision, length, conv = m.groups()
+    out.append(fmt[pos:m.start()])
+    pos = m.end()
+    if conv == "%":
+      out.append("%")
+      continue
+    if width == "*":
+      width = str(struct.unpack("<i", struct.pack("<I", values.pop(0)))[0]) if values else ""
+    if precision == "*":
+      precision = str(struct.unpack("<i", struct.pack("<I", values.pop(0)))[0]) if values else ""
+    if not values:
+      out.append(m.group(0))
+      continue
+    value = values.pop(0)
+    spec = "%" + flags + (width or "") + ("." + precision if precision else "")
+    if conv in "di":
+      out.append((spec + "d") % struct.unpack("<i", struct.pack("<I", value))[0])
+    elif conv in "ouxXc":
+      out.append((spec + conv) % value)
+    elif conv in "fFeEgGaA":
+      f = struct.unpack("<f", struct.pack("<I", value))[0]
+      out.append((spec + ("f" if conv in "aA" else conv)) % f)
+    elif conv == "s":
+      s = elf.string(value)
+      out.append((spec + "s") % (s if s is not None else "<0x%08x>" % value))
+    else:
+      out.append("0x%08x" % value)
+  out.append(fmt[pos:])
+  return "".join(out)
+
+
+def decode(data, tokens, elf):
+  i = 0
+  text = bytearray()
+  while i < len(data):
+    if data[i] != SYNC or i + 2 >= len(data):
+      text.append(data[i])
+      i += 1
+      continue
+    length = data[i + 1]
+    end = i + 2 + length + 1
+    if length < 5 or (length - 5) % 4 != 0 or end > len(data) or sum(data[i + 1:end]) % 256 != 0:
+      # Not a packet, e.g. a corrupted one
+      text.append(data[i])
+      i += 1
+      continue
+    if text:
+      sys.stdout.write(text.decode(errors="replace"))
+      text = bytearray()
+    token = data[i + 2]
+    timestamp = struct.unpack("<I", data[i + 3:i + 7])[0]
+    words = list(struct.unpack("<%dI" % ((length - 5) // 4), data[i + 7:end - 1]))
+    if token == FORMAT_TOKEN and words:
+      fmt = elf.string(words[0])
+      line = format_args(fmt, words[1:], elf) if fmt is not None else \
+          "<format 0x%08x> %s" % (words[0], " ".join("0x%08x" % w for w in words[1:]))
+      line = line.rstrip("\r\n") + "\r\n"
+    elif token < len(tokens):
+      line = format_args(tokens[token][1], words, elf)
+    else:
+      line = "<token %d> %s\r\n" % (token, " ".join("0x%08x" % w for w in words))
+    sys.stdout.write("%lu %s" % (timestamp, line))
+    i = end
+  sys.stdout.write(text.decode(errors="replace"))
+
+
+if len(sys.argv) > 1:
+  INPUT = sys.argv[1]
+if len(sys.argv) > 2:
+  ELF = sys.argv[2]
+
+decode(open(INPUT, "rb").read(), read_tokens(TOKENS_HEADER), Elf(ELF))